@@ -0,0 +1,612 @@
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+/****************************************************************************/
+/*  Header    : Benchmark Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : Benchmark.hpp												*/
+/*                                                                          */
+/*  @brief	  : Measures the cycles of the wrappers against the same calls	*/
+/*				of the raw FreeRTOS API on the same kernel objects			*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- 14.10.2026	NZ	Mod: Uses the shared CycleCounter		*/
+/*				- 14.10.2026	NZ	Add: Context switch case and pass/fail	*/
+/*									threshold								*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstddef>
+#include <cstdint>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <semphr.h>
+
+#include "CycleCounter.hpp"
+#include "FreeRTOS.hpp"
+#include "Queue.hpp"
+#include "Semaphore.hpp"
+#include "Task.hpp"
+
+/* Class constant declaration  */
+#ifndef BENCHMARK_THRESHOLD_PERCENT
+#define BENCHMARK_THRESHOLD_PERCENT	10	///< Default of the maximum overhead of the wrapper over the raw API
+#endif
+
+/* Class Type declaration      */
+struct BenchmarkResult {
+	uint32_t						minimum = UINT32_MAX;
+	uint32_t						maximum = 0;
+	uint64_t						total = 0;
+	uint32_t						iterations = 0;
+
+	void add(uint32_t counts);
+
+	uint32_t average(void) const											{return (iterations != 0) ? (uint32_t) (total / iterations) : 0;};
+};
+
+template <size_t Size>
+struct BenchmarkPayload {
+	uint8_t							data[Size];
+};
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <configSTACK_DEPTH_TYPE StackDepth = (configMINIMAL_STACK_SIZE * 2)>
+class Benchmark : public FreeRTOS
+{
+public:
+	using Report = void (*)(const char *name, const BenchmarkResult &wrapper, const BenchmarkResult &raw, bool passed, void *context);
+
+protected:
+	enum class Mode {
+		notify,
+		semaphore,
+		trigger,
+		contextSwitch
+	};
+
+	template <typename T>
+	class RawQueue : public QueueStatic<T, 1>
+	{
+	public:
+		QueueHandle_t getHandle(void)										{return this->handle;};
+	};
+
+	class RawSemaphore : public SemaphoreStatic
+	{
+	public:
+		RawSemaphore(void): SemaphoreStatic(1, 0) {};
+
+		SemaphoreHandle_t getHandle(void)									{return handle;};
+	};
+
+	class RawTask : public TaskStatic<StackDepth>
+	{
+	public:
+		RawTask(TaskFunction_t taskFunction, void *taskParameters, UBaseType_t taskPriority): TaskStatic<StackDepth>(taskFunction, "bench", taskParameters, taskPriority) {};
+
+		TaskHandle_t getHandle(void)										{return this->handle;};
+	};
+
+	RawSemaphore					ping;
+	RawSemaphore					pong;
+	RawSemaphore					isrSemaphore;
+	RawTask							partner;
+	volatile Mode					mode = Mode::notify;
+	TaskHandle_t volatile			owner = NULL;
+	volatile bool					rawFromISR = false;
+	void							(*volatile trigger)(void) = NULL;
+	volatile uint32_t				triggerStamp = 0;
+	volatile uint32_t				switchStamp = 0;
+	BenchmarkResult					switchResult;
+	uint32_t						overhead = 0;
+	uint32_t						thresholdPercent = BENCHMARK_THRESHOLD_PERCENT;
+
+	void static partnerFunction(void *parameter);
+
+	void setMode(Mode newMode);
+
+	template <typename Function>
+	BenchmarkResult measure(uint32_t iterations, Function &&function);
+
+	template <size_t Size>
+	bool queueRoundTrip(const char *name, uint32_t iterations, Report report, void *context);
+
+	template <typename Function>
+	BenchmarkResult measureLatency(uint32_t iterations, Function &&function);
+
+	template <typename Function>
+	BenchmarkResult measureSwitch(uint32_t iterations, Function &&function);
+
+	bool check(const char *name, const BenchmarkResult &wrapper, const BenchmarkResult &raw, Report report, void *context);
+
+public:
+	Benchmark(UBaseType_t partnerPriority);
+
+	Benchmark(const Benchmark &) = delete;
+	Benchmark &operator=(const Benchmark &) = delete;
+
+	void setThreshold(uint32_t percent)										{thresholdPercent = percent;};
+
+	bool run(uint32_t iterations, Report report, void *context);
+
+	bool runFromISR(uint32_t iterations, void (*isrTrigger)(void), Report report, void *context);
+
+	void signalFromISR(void);
+};
+
+/**
+ * @brief		Adds the counts of one call
+ *
+ * @param		counts		Counts of the call, without the overhead
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void BenchmarkResult::add(uint32_t counts)
+{
+	minimum = (counts < minimum) ? counts : minimum;
+	maximum = (counts > maximum) ? counts : maximum;
+	total += counts;
+	iterations++;
+}
+
+/**
+ * @brief		Constructor
+ *
+ * @param		partnerPriority		Priority of the partner task of the ping-pong cases
+ *
+ * @details		Creates the semaphores, empty with a maximum count of 1, and
+ * 				the partner task, all inside the object, and enables the cycle
+ * 				counter. The partner is blocked until a ping-pong case runs.
+ * 				The counts are cycles of the CycleCounter on Cortex-M and
+ * 				nanoseconds on other ports.
+ * @warning		run() must be called from a task with a lower priority than
+ * 				`partnerPriority`, so the partner always blocks again before
+ * 				the measuring task continues.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline Benchmark<StackDepth>::Benchmark(UBaseType_t partnerPriority): partner(&Benchmark::partnerFunction, (void *) this, partnerPriority)
+{
+	CycleCounter::enable();
+}
+
+/**
+ * @brief		Task function of the partner
+ *
+ * @param		parameter		Pointer to the benchmark
+ * @return		void
+ *
+ * @details		Answers every ping of the measuring task with the raw API, so
+ * 				both variants of a case see the same partner. In `notify` mode
+ * 				it waits on its notification and notifies the owner, in
+ * 				`semaphore` mode it takes `ping` and gives `pong`. In
+ * 				`trigger` mode it waits on its notification as well, then
+ * 				stamps the counter and pends the interrupt of runFromISR().
+ * 				In `contextSwitch` mode it waits on its notification and adds
+ * 				the counts since the stamp of the measuring task.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline void Benchmark<StackDepth>::partnerFunction(void *parameter)
+{
+	Benchmark *benchmark = static_cast<Benchmark *>(parameter); // Benchmark of the partner
+	uint32_t elapsed; // Counts since the stamp of the measuring task
+
+	for (;;) {
+		if (benchmark->mode == Mode::semaphore) {
+			xSemaphoreTake(benchmark->ping.getHandle(), portMAX_DELAY);
+			xSemaphoreGive(benchmark->pong.getHandle());
+		} else {
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+			if (benchmark->mode == Mode::trigger) {
+				benchmark->triggerStamp = CycleCounter::get();
+				benchmark->trigger();
+			} else if (benchmark->mode == Mode::contextSwitch) {
+				elapsed = CycleCounter::get() - benchmark->switchStamp;
+				benchmark->switchResult.add((elapsed > benchmark->overhead) ? (elapsed - benchmark->overhead) : 0);
+			} else {
+				xTaskNotifyGive(benchmark->owner);
+			}
+		}
+	}
+}
+
+/**
+ * @brief		Switches the partner to another mode
+ *
+ * @param		newMode		Mode of the next ping-pong case
+ * @return		void
+ *
+ * @details		The partner is blocked in the old mode, so one round trip of
+ * 				the old mode is done after the mode was set. The partner has
+ * 				the higher priority, it blocks in the new mode before this
+ * 				returns.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline void Benchmark<StackDepth>::setMode(Mode newMode)
+{
+	Mode oldMode = mode; // Mode the partner is blocked in
+
+	if (oldMode == newMode) {
+		return;
+	}
+
+	mode = newMode;
+
+	if (oldMode == Mode::notify) {
+		xTaskNotifyGive(partner.getHandle());
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	} else {
+		xSemaphoreGive(ping.getHandle());
+		xSemaphoreTake(pong.getHandle(), portMAX_DELAY);
+	}
+}
+
+/**
+ * @brief		Measures a function
+ *
+ * @param		iterations		Number of calls to measure
+ * @param		function		Function to measure, called without arguments
+ * @return		Minimum, maximum and total counts of the calls
+ *
+ * @details		Reads the counter before and after every call and subtracts
+ * 				the overhead of the two reads, measured with an empty
+ * 				function. Interrupts are not disabled, they show up in the
+ * 				maximum, the minimum is the figure to compare.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+template <typename Function>
+inline BenchmarkResult Benchmark<StackDepth>::measure(uint32_t iterations, Function &&function)
+{
+	BenchmarkResult result; // Collected counts
+	uint32_t start; // Counter before the call
+	uint32_t elapsed; // Counts of the call
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		start = CycleCounter::get();
+		function();
+		elapsed = CycleCounter::get() - start;
+
+		result.add((elapsed > overhead) ? (elapsed - overhead) : 0);
+	}
+
+	return result;
+}
+
+/**
+ * @brief		Measures the latency from the trigger until the task runs
+ *
+ * @param		iterations		Number of interrupts to measure
+ * @param		function		Blocks until the interrupt woke the task
+ * @return		Minimum, maximum and total counts of the latencies
+ *
+ * @details		Notifies the partner and calls `function`, which blocks. Only
+ * 				then the partner runs, stamps the counter and pends the
+ * 				interrupt, so the counts are from the stamp until `function`
+ * 				returned. The partner must be in `trigger` mode and the calling
+ * 				task must have a higher priority than the partner.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+template <typename Function>
+inline BenchmarkResult Benchmark<StackDepth>::measureLatency(uint32_t iterations, Function &&function)
+{
+	BenchmarkResult result; // Collected counts
+	uint32_t elapsed; // Counts from the stamp of the partner
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		xTaskNotifyGive(partner.getHandle());
+		function();
+		elapsed = CycleCounter::get() - triggerStamp;
+
+		result.add((elapsed > overhead) ? (elapsed - overhead) : 0);
+	}
+
+	return result;
+}
+
+/**
+ * @brief		Measures a single context switch
+ *
+ * @param		iterations		Number of switches to measure
+ * @param		function		Notifies the partner, which preempts the caller
+ * @return		Minimum, maximum and total counts of the switches
+ *
+ * @details		Stamps the counter and calls `function`. The partner has the
+ * 				higher priority, so it runs right inside `function` and adds
+ * 				the counts since the stamp, before it blocks again and the
+ * 				calling task continues. So one count is the notification and
+ * 				one context switch, not a round trip. The partner must be in
+ * 				`contextSwitch` mode.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+template <typename Function>
+inline BenchmarkResult Benchmark<StackDepth>::measureSwitch(uint32_t iterations, Function &&function)
+{
+	switchResult = BenchmarkResult();
+
+	for (uint32_t i = 0; i < iterations; i++) {
+		switchStamp = CycleCounter::get();
+		function();
+	}
+
+	return switchResult;
+}
+
+/**
+ * @brief		Compares the wrapper with the raw API and reports a case
+ *
+ * @param		name			Name of the case passed to `report`
+ * @param		wrapper			Counts of the wrapper
+ * @param		raw				Counts of the raw API
+ * @param		report			Called with the results
+ * @param		context			Passed to `report`
+ * @return		True if the wrapper is within the threshold, false otherwise
+ *
+ * @details		The case passes if the minimum of the wrapper doesn't exceed
+ * 				the minimum of the raw API by more than the threshold in
+ * 				percent, see setThreshold(). The minimum is compared, because
+ * 				interrupts only show up in the maximum and the average.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline bool Benchmark<StackDepth>::check(const char *name, const BenchmarkResult &wrapper, const BenchmarkResult &raw, Report report, void *context)
+{
+	uint64_t limit = (uint64_t) raw.minimum * (100 + thresholdPercent) / 100; // Maximum allowed minimum of the wrapper
+	bool passed = ((uint64_t) wrapper.minimum <= limit) ? true : false; // Result of the case
+
+	report(name, wrapper, raw, passed, context);
+
+	return passed;
+}
+
+/**
+ * @brief		Measures a queue round trip of one payload size
+ *
+ * @param		name			Name of the case passed to `report`
+ * @param		iterations		Number of round trips to measure
+ * @param		report			Called with the results
+ * @param		context			Passed to `report`
+ * @return		True if the wrapper is within the threshold, false otherwise
+ *
+ * @details		Sends one item to an empty queue and receives it again, in
+ * 				the same task and without blocking. Once with `Queue<T>` and
+ * 				once with xQueueSendToBack() and xQueueReceive() on the same
+ * 				queue.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+template <size_t Size>
+inline bool Benchmark<StackDepth>::queueRoundTrip(const char *name, uint32_t iterations, Report report, void *context)
+{
+	static RawQueue<BenchmarkPayload<Size>> queue; // Queue of one item
+	BenchmarkPayload<Size> item = {}; // Item to send
+	BenchmarkPayload<Size> received; // Received item
+	BenchmarkResult wrapper; // Counts of the wrapper
+	BenchmarkResult raw; // Counts of the raw API
+
+	wrapper = measure(iterations, [&] {
+		queue.sendToBack(item, 0);
+		queue.tryReceive(received, 0);
+	});
+
+	raw = measure(iterations, [&] {
+		xQueueSendToBack(queue.getHandle(), &item, 0);
+		xQueueReceive(queue.getHandle(), &received, 0);
+	});
+
+	return check(name, wrapper, raw, report, context);
+}
+
+/**
+ * @brief		Runs all cases that need no interrupt
+ *
+ * @param		iterations		Number of calls per case and variant
+ * @param		report			Called with the results of every case
+ * @param		context			Passed to `report`
+ * @return		True if all cases are within the threshold, false otherwise
+ *
+ * @details		Every case is measured with the wrappers and with the raw C
+ * 				API on the same kernel objects, so the difference is the cost
+ * 				of the wrapper:
+ * 				- Queue send and receive round trips of 4, 16 and 64 bytes.
+ * 				- Semaphore give/take ping-pong with the partner task.
+ * 				- Task notification ping-pong with the partner task.
+ * 				- Context switch, from the notification of the partner until
+ * 				  it runs, measured by the partner itself.
+ * 				Every case is passed or failed against the threshold, see
+ * 				check(), so a regression of the wrappers fails the run.
+ * @warning		Call it from a task with a lower priority than the partner,
+ * 				after the scheduler was started.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline bool Benchmark<StackDepth>::run(uint32_t iterations, Report report, void *context)
+{
+	BenchmarkResult wrapper; // Counts of the wrapper
+	BenchmarkResult raw; // Counts of the raw API
+	bool passed = true; // Result of all cases
+
+	owner = xTaskGetCurrentTaskHandle();
+
+	overhead = 0;
+	overhead = measure(iterations, [] {}).minimum;
+
+	passed &= queueRoundTrip<4>("queue 4 bytes", iterations, report, context);
+	passed &= queueRoundTrip<16>("queue 16 bytes", iterations, report, context);
+	passed &= queueRoundTrip<64>("queue 64 bytes", iterations, report, context);
+
+	setMode(Mode::semaphore);
+
+	wrapper = measure(iterations, [this] {
+		ping.give();
+		pong.take(portMAX_DELAY);
+	});
+
+	raw = measure(iterations, [this] {
+		xSemaphoreGive(ping.getHandle());
+		xSemaphoreTake(pong.getHandle(), portMAX_DELAY);
+	});
+
+	passed &= check("semaphore ping-pong", wrapper, raw, report, context);
+
+	setMode(Mode::notify);
+
+	wrapper = measure(iterations, [this] {
+		partner.notifyGive();
+		Task::notifyTake(true, portMAX_DELAY);
+	});
+
+	raw = measure(iterations, [this] {
+		xTaskNotifyGive(partner.getHandle());
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	});
+
+	passed &= check("notification ping-pong", wrapper, raw, report, context);
+
+	mode = Mode::contextSwitch;
+
+	wrapper = measureSwitch(iterations, [this] {
+		partner.notifyGive();
+	});
+
+	raw = measureSwitch(iterations, [this] {
+		xTaskNotifyGive(partner.getHandle());
+	});
+
+	mode = Mode::notify;
+
+	passed &= check("context switch", wrapper, raw, report, context);
+
+	return passed;
+}
+
+/**
+ * @brief		Runs the ISR to task latency case
+ *
+ * @param		iterations		Number of interrupts per variant
+ * @param		isrTrigger		Pends the interrupt that calls signalFromISR()
+ * @param		report			Called with the results
+ * @param		context			Passed to `report`
+ * @return		True if the wrapper is within the threshold, false otherwise
+ *
+ * @details		The measuring task blocks on the ISR semaphore first, then
+ * 				the partner stamps the counter and calls `isrTrigger`. So the
+ * 				counts are from pending the interrupt until the blocked task
+ * 				woken by signalFromISR() runs: the interrupt entry, the give
+ * 				and the context switch. For this the calling task runs one
+ * 				priority above the partner during the case, the old priority
+ * 				is restored afterwards. The interrupt is board specific, e.g.
+ * 				an unused NVIC interrupt pended with `NVIC->STIR` on the
+ * 				STM32, or a signal on the POSIX port.
+ * @warning		Call it from a task after run(), which measures the overhead
+ * 				of the counter. The interrupt must have a priority the FromISR
+ * 				API may be used with. The priority of the partner must be
+ * 				lower than `configMAX_PRIORITIES - 1`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline bool Benchmark<StackDepth>::runFromISR(uint32_t iterations, void (*isrTrigger)(void), Report report, void *context)
+{
+	BenchmarkResult wrapper; // Counts of the wrapper
+	BenchmarkResult raw; // Counts of the raw API
+	UBaseType_t priority = uxTaskPriorityGet(NULL); // Priority of the calling task
+
+	assert(partner.getPriority() < (configMAX_PRIORITIES - 1));
+
+	setMode(Mode::notify);
+
+	trigger = isrTrigger;
+	mode = Mode::trigger;
+	vTaskPrioritySet(NULL, partner.getPriority() + 1);
+
+	rawFromISR = false;
+	wrapper = measureLatency(iterations, [this] {
+		isrSemaphore.take(portMAX_DELAY);
+	});
+
+	rawFromISR = true;
+	raw = measureLatency(iterations, [this] {
+		xSemaphoreTake(isrSemaphore.getHandle(), portMAX_DELAY);
+	});
+
+	vTaskPrioritySet(NULL, priority);
+	mode = Mode::notify;
+
+	return check("isr to task latency", wrapper, raw, report, context);
+}
+
+/**
+ * @brief		Wakes the measuring task of runFromISR()
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Gives the ISR semaphore with the wrapper or the raw API,
+ * 				depending on the variant measured, and requests the context
+ * 				switch at the end of the ISR.
+ * @warning		Call it only from the interrupt pended by `trigger`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline void Benchmark<StackDepth>::signalFromISR(void)
+{
+	BaseType_t higherPriorityTaskWoken = pdFALSE; // Set if the measuring task was woken
+
+	if (rawFromISR == true) {
+		xSemaphoreGiveFromISR(isrSemaphore.getHandle(), &higherPriorityTaskWoken);
+	} else {
+		isrSemaphore.giveFromISR(&higherPriorityTaskWoken);
+	}
+
+	portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Benchmark Class												*/
+/****************************************************************************/
+#endif /* BENCHMARK_HPP_ */
@@ -0,0 +1,242 @@
+#ifndef CRITICALSECTION_HPP_
+#define CRITICALSECTION_HPP_
+/****************************************************************************/
+/*  Header    : Critical Section Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : CriticalSection.hpp											*/
+/*                                                                          */
+/*  @brief	  : RAII guards for critical sections, the scheduler lock and	*/
+/*				the interrupt priority mask									*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstdint>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class CriticalSection
+{
+public:
+	CriticalSection(void);
+
+	~CriticalSection(void);
+
+	CriticalSection(const CriticalSection &) = delete;
+	CriticalSection &operator=(const CriticalSection &) = delete;
+};
+
+/* Class definition            */
+class CriticalSectionFromISR
+{
+protected:
+	const UBaseType_t				savedInterruptStatus;
+
+public:
+	CriticalSectionFromISR(void);
+
+	~CriticalSectionFromISR(void);
+
+	CriticalSectionFromISR(const CriticalSectionFromISR &) = delete;
+	CriticalSectionFromISR &operator=(const CriticalSectionFromISR &) = delete;
+};
+
+/* Class definition            */
+class SchedulerLock
+{
+public:
+	SchedulerLock(void);
+
+	~SchedulerLock(void);
+
+	SchedulerLock(const SchedulerLock &) = delete;
+	SchedulerLock &operator=(const SchedulerLock &) = delete;
+};
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+/* Class definition            */
+template <uint32_t Priority = configMAX_SYSCALL_INTERRUPT_PRIORITY>
+class BasepriGuard
+{
+	static_assert(Priority != 0, "A BASEPRI of 0 masks nothing");
+
+protected:
+	uint32_t						savedBasepri;
+
+public:
+	BasepriGuard(void);
+
+	~BasepriGuard(void);
+
+	BasepriGuard(const BasepriGuard &) = delete;
+	BasepriGuard &operator=(const BasepriGuard &) = delete;
+};
+#endif
+
+/**
+ * @brief		Constructor, enters a critical section
+ *
+ * @param		void
+ *
+ * @details		Calls taskENTER_CRITICAL(), the critical section is left when
+ * 				the object goes out of scope. Meant for updates of shared data
+ * 				of a few instructions, where a mutex would cost far more than
+ * 				the update itself. Critical sections nest.
+ * @warning		Interrupts up to configMAX_SYSCALL_INTERRUPT_PRIORITY are
+ * 				masked, keep the section as short as possible and never call
+ * 				a blocking API function inside.
+ * @see			https://www.freertos.org/taskENTER_CRITICAL_taskEXIT_CRITICAL.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline CriticalSection::CriticalSection(void)
+{
+	taskENTER_CRITICAL();
+}
+
+/**
+ * @brief		Destructor, leaves the critical section
+ *
+ * @details		Calls taskEXIT_CRITICAL().
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline CriticalSection::~CriticalSection(void)
+{
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Constructor, enters a critical section from ISR
+ *
+ * @param		void
+ *
+ * @details		Calls taskENTER_CRITICAL_FROM_ISR() and keeps the returned
+ * 				interrupt mask in the object, so it's restored when the object
+ * 				goes out of scope. Nested sections restore in reverse order.
+ * @see			https://www.freertos.org/taskENTER_CRITICAL_FROM_ISR_taskEXIT_CRITICAL_FROM_ISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline CriticalSectionFromISR::CriticalSectionFromISR(void): savedInterruptStatus(taskENTER_CRITICAL_FROM_ISR())
+{
+}
+
+/**
+ * @brief		Destructor, leaves the critical section from ISR
+ *
+ * @details		Calls taskEXIT_CRITICAL_FROM_ISR() with the saved mask.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline CriticalSectionFromISR::~CriticalSectionFromISR(void)
+{
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Constructor, suspends the scheduler
+ *
+ * @param		void
+ *
+ * @details		Calls vTaskSuspendAll(), the scheduler is resumed with
+ * 				xTaskResumeAll() when the object goes out of scope. Interrupts
+ * 				stay enabled, so it suits longer sections that only share
+ * 				data with other tasks.
+ * @warning		No API function that could block may be called inside.
+ * @see			https://www.freertos.org/a00134.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline SchedulerLock::SchedulerLock(void)
+{
+	vTaskSuspendAll();
+}
+
+/**
+ * @brief		Destructor, resumes the scheduler
+ *
+ * @details		Calls xTaskResumeAll(), a pending context switch is done here.
+ * @see			https://www.freertos.org/a00135.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline SchedulerLock::~SchedulerLock(void)
+{
+	(void) xTaskResumeAll();
+}
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+/**
+ * @brief		Constructor, raises the interrupt priority mask
+ *
+ * @param		void
+ *
+ * @details		Saves BASEPRI and raises it to `Priority` with `basepri_max`,
+ * 				so the mask is only ever raised and never lowered. Interrupts
+ * 				with a priority value equal or higher than `Priority` are
+ * 				masked, more urgent ones keep running. `Priority` is the
+ * 				shifted value as written to the register, like
+ * 				configMAX_SYSCALL_INTERRUPT_PRIORITY. Works in tasks and ISRs,
+ * 				the old mask is restored when the object goes out of scope.
+ * @warning		With a `Priority` below configMAX_SYSCALL_INTERRUPT_PRIORITY
+ * 				(more urgent), the masked ISRs must not use any API function.
+ * 				Only for Cortex-M3/M4/M7/M33.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <uint32_t Priority>
+inline BasepriGuard<Priority>::BasepriGuard(void)
+{
+	__asm volatile ("mrs %0, basepri" : "=r" (savedBasepri) :: "memory");
+	__asm volatile ("msr basepri_max, %0" :: "r" (Priority) : "memory");
+	__asm volatile ("isb" ::: "memory");
+	__asm volatile ("dsb" ::: "memory");
+}
+
+/**
+ * @brief		Destructor, restores the interrupt priority mask
+ *
+ * @details		Writes the saved value back to BASEPRI.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <uint32_t Priority>
+inline BasepriGuard<Priority>::~BasepriGuard(void)
+{
+	__asm volatile ("msr basepri, %0" :: "r" (savedBasepri) : "memory");
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Critical Section Class										*/
+/****************************************************************************/
+#endif /* CRITICALSECTION_HPP_ */
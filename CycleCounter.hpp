@@ -0,0 +1,105 @@
+#ifndef CYCLECOUNTER_HPP_
+#define CYCLECOUNTER_HPP_
+/****************************************************************************/
+/*  Header    : Cycle Counter Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : CycleCounter.hpp											*/
+/*                                                                          */
+/*  @brief	  : DWT cycle counter of the Cortex-M, shared by Trace and		*/
+/*				Benchmark													*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstdint>
+
+#if !(defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__))
+#include <chrono>
+#endif
+
+/* Class constant declaration  */
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+#define CYCLECOUNTER_DWT			1
+#define CYCLECOUNTER_DEMCR			(*(volatile uint32_t *) 0xE000EDFCUL)	///< CoreDebug->DEMCR
+#define CYCLECOUNTER_DEMCR_TRCENA	(1UL << 24)
+#define CYCLECOUNTER_DWT_CTRL		(*(volatile uint32_t *) 0xE0001000UL)	///< DWT->CTRL
+#define CYCLECOUNTER_DWT_CYCCNTENA	(1UL << 0)
+#define CYCLECOUNTER_DWT_CYCCNT		(*(volatile uint32_t *) 0xE0001004UL)	///< DWT->CYCCNT
+#else
+#define CYCLECOUNTER_DWT			0
+#endif
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class CycleCounter
+{
+public:
+	void static enable(void);
+
+	uint32_t static get(void);
+};
+
+/**
+ * @brief		Enables the cycle counter
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		On Cortex-M3/M4/M7/M33 TRCENA in the DEMCR and CYCCNTENA in
+ * 				DWT_CTRL are set and the DWT cycle counter is cleared, the
+ * 				registers are accessed directly, so CMSIS isn't needed. On
+ * 				other ports, like the POSIX/Linux simulator, the counter is
+ * 				std::chrono::steady_clock and there is nothing to enable.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void CycleCounter::enable(void)
+{
+#if (CYCLECOUNTER_DWT == 1)
+	CYCLECOUNTER_DEMCR |= CYCLECOUNTER_DEMCR_TRCENA;
+	CYCLECOUNTER_DWT_CYCCNT = 0;
+	CYCLECOUNTER_DWT_CTRL |= CYCLECOUNTER_DWT_CYCCNTENA;
+#endif
+}
+
+/**
+ * @brief		Gets the cycle counter
+ *
+ * @param		void
+ * @return		Cycles on Cortex-M, nanoseconds on other ports
+ *
+ * @details		The value wraps around, differences are correct as long as
+ * 				the measured time takes less than 2^32 counts.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t CycleCounter::get(void)
+{
+#if (CYCLECOUNTER_DWT == 1)
+	return CYCLECOUNTER_DWT_CYCCNT;
+#else
+	return (uint32_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/****************************************************************************/
+/* End Header : Cycle Counter Class											*/
+/****************************************************************************/
+#endif /* CYCLECOUNTER_HPP_ */
@@ -0,0 +1,454 @@
+#ifndef EVENTGROUP_HPP_
+#define EVENTGROUP_HPP_
+/****************************************************************************/
+/*  Header    : Event Group Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : EventGroup.hpp												*/
+/*                                                                          */
+/*  @brief	  : FreeRTOS-Event-Group Wrapper class							*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+
+#include <FreeRTOS.h>
+#include <event_groups.h>
+
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class EventGroup : public FreeRTOS
+{
+protected:
+	EventGroupHandle_t		handle;
+
+	TickType_t				defaultBlockTime = portMAX_DELAY;
+
+public:
+#if (configUSE_16_BIT_TICKS == 1)
+	static constexpr EventBits_t usableBits = 0x00FF;
+#else
+	static constexpr EventBits_t usableBits = 0x00FFFFFF;
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	EventGroup(void);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	EventGroup(StaticEventGroup_t *eventGroupBuffer);
+#endif
+
+	~EventGroup(void);
+
+	EventBits_t getBits(void);
+
+	EventBits_t getBitsFromISR(void);
+
+	EventBits_t setBits(EventBits_t bitsToSet);
+
+	EventBits_t clearBits(EventBits_t bitsToClear);
+
+#if (INCLUDE_xTimerPendFunctionCall == 1) && (configUSE_TIMERS == 1)
+	bool setBitsFromISR(EventBits_t bitsToSet, BaseType_t *higherPriorityTaskWoken);
+	bool setBitsFromISR(EventBits_t bitsToSet);
+
+	bool clearBitsFromISR(EventBits_t bitsToClear);
+#endif
+
+	EventBits_t waitBits(EventBits_t bitsToWaitFor, bool waitForAllBits, bool clearOnExit, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	EventBits_t waitBits(EventBits_t bitsToWaitFor, bool waitForAllBits, bool clearOnExit, const std::chrono::duration<Rep, Period> timeToWait)	{return waitBits(bitsToWaitFor, waitForAllBits, clearOnExit, convertToTicks(timeToWait));};
+	EventBits_t waitBits(EventBits_t bitsToWaitFor, bool waitForAllBits, bool clearOnExit);
+
+	EventBits_t sync(EventBits_t bitsToSet, EventBits_t bitsToWaitFor, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	EventBits_t sync(EventBits_t bitsToSet, EventBits_t bitsToWaitFor, const std::chrono::duration<Rep, Period> timeToWait)	{return sync(bitsToSet, bitsToWaitFor, convertToTicks(timeToWait));};
+	EventBits_t sync(EventBits_t bitsToSet, EventBits_t bitsToWaitFor);
+
+	void setDefaultBlockTime(TickType_t newBlockTime);
+	template <typename Rep, typename Period>
+	void setDefaultBlockTime(const std::chrono::duration<Rep, Period> newBlockTime)			{setDefaultBlockTime(convertToTicks(newBlockTime));};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+class EventGroupStatic : public EventGroup
+{
+protected:
+	StaticEventGroup_t		eventGroupBuffer;
+
+public:
+	EventGroupStatic(void);
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor
+ *
+ * @param		void
+ *
+ * @details		Constructs a new event group object with the FreeRTOS API
+ * 				function xEventGroupCreate(). All bits are cleared.
+ * @see			https://www.freertos.org/xEventGroupCreate.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventGroup::EventGroup(void)
+{
+	handle = xEventGroupCreate();
+
+	assert(handle != NULL);
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		eventGroupBuffer	Used to hold the event group's data structure
+ *
+ * @details		Constructs a new event group object with the FreeRTOS API
+ * 				function xEventGroupCreateStatic(). No memory is allocated
+ * 				from the FreeRTOS heap.
+ * @see			https://www.freertos.org/xEventGroupCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventGroup::EventGroup(StaticEventGroup_t *eventGroupBuffer)
+{
+	handle = xEventGroupCreateStatic(eventGroupBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor static event group
+ *
+ * @param		void
+ *
+ * @details		Constructs a new event group object, the event group
+ * 				structure is a member of the object.
+ * @see			https://www.freertos.org/xEventGroupCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventGroupStatic::EventGroupStatic(void): EventGroup(&eventGroupBuffer)
+{
+};
+#endif
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Deletes the event group with the FreeRTOS API function
+ * 				vEventGroupDelete(). Tasks that are blocked on the event group
+ * 				are unblocked and get 0 as event value.
+ * @see			https://www.freertos.org/vEventGroupDelete.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventGroup::~EventGroup(void)
+{
+	vEventGroupDelete(handle);
+};
+
+/**
+ * @brief		Gets the current bits
+ *
+ * @param		void
+ * @return		Value of the event bits when the method was called
+ *
+ * @see			https://www.freertos.org/xEventGroupGetBits.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::getBits(void)
+{
+	return xEventGroupGetBits(handle);
+}
+
+/**
+ * @brief		Gets the current bits from ISR
+ *
+ * @param		void
+ * @return		Value of the event bits when the method was called
+ *
+ * @see			https://www.freertos.org/xEventGroupGetBitsFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::getBitsFromISR(void)
+{
+	return xEventGroupGetBitsFromISR(handle);
+}
+
+/**
+ * @brief		Sets bits
+ *
+ * @param		bitsToSet		Bits to set, e.g. 0x09 sets bit 3 and bit 0
+ * @return		Value of the event bits after the bits were set
+ *
+ * @details		Sets the bits with the FreeRTOS API function
+ * 				xEventGroupSetBits(). All tasks waiting for the bits are
+ * 				unblocked. The returned value can have the bits cleared again,
+ * 				if an unblocked task waited with `clearOnExit`.
+ * @warning		Only the lower 8 bits (configUSE_16_BIT_TICKS = 1) or 24 bits
+ * 				are usable, see `usableBits`.
+ * @see			https://www.freertos.org/xEventGroupSetBits.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::setBits(EventBits_t bitsToSet)
+{
+	assert((bitsToSet & ~usableBits) == 0);
+
+	return xEventGroupSetBits(handle, bitsToSet);
+}
+
+/**
+ * @brief		Clears bits
+ *
+ * @param		bitsToClear		Bits to clear
+ * @return		Value of the event bits before the bits were cleared
+ *
+ * @see			https://www.freertos.org/xEventGroupClearBits.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::clearBits(EventBits_t bitsToClear)
+{
+	assert((bitsToClear & ~usableBits) == 0);
+
+	return xEventGroupClearBits(handle, bitsToClear);
+}
+
+#if (INCLUDE_xTimerPendFunctionCall == 1) && (configUSE_TIMERS == 1)
+/**
+ * @brief		Sets bits from ISR
+ *
+ * @param		bitsToSet					Bits to set
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if the request was sent to the timer task, false otherwise
+ *
+ * @details		Setting bits is not deterministic, because an unknown number
+ * 				of tasks could be waiting. So xEventGroupSetBitsFromISR()
+ * 				defers the work to the timer service task. If the timer task
+ * 				has a higher priority than the interrupted task,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE and a context switch
+ * 				should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object, so the bits are set directly after the
+ * 				ISR instead of at the next tick.
+ * @warning		False is returned if the timer command queue is full, the bits
+ * 				are not set in that case.
+ * @see			https://www.freertos.org/xEventGroupSetBitsFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool EventGroup::setBitsFromISR(EventBits_t bitsToSet, BaseType_t *higherPriorityTaskWoken)
+{
+	return (xEventGroupSetBitsFromISR(handle, bitsToSet, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Sets bits from ISR
+ *
+ * @param		bitsToSet		Bits to set
+ * @return		True if the request was sent to the timer task, false otherwise
+ *
+ * @details		Sets the bits from an interrupt service routine, deferred to the
+ * 				timer service task.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. The timer task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xEventGroupSetBitsFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool EventGroup::setBitsFromISR(EventBits_t bitsToSet)
+{
+	return EventGroup::setBitsFromISR(bitsToSet, NULL);
+}
+
+/**
+ * @brief		Clears bits from ISR
+ *
+ * @param		bitsToClear		Bits to clear
+ * @return		True if the request was sent to the timer task, false otherwise
+ *
+ * @details		Like setBitsFromISR(), the work is deferred to the timer service
+ * 				task. Clearing bits never unblocks a task, so no context switch
+ * 				is needed.
+ * @see			https://www.freertos.org/xEventGroupClearBitsFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool EventGroup::clearBitsFromISR(EventBits_t bitsToClear)
+{
+	return (xEventGroupClearBitsFromISR(handle, bitsToClear) == pdPASS) ? true : false;
+}
+#endif
+
+/**
+ * @brief		Waits for bits
+ *
+ * @param		bitsToWaitFor	Bits to wait for, must not be 0
+ * @param		waitForAllBits	True to wait for all bits, false to wait for any bit
+ * @param		clearOnExit		True to clear the bits that were waited for on exit
+ * @param		ticksToWait		Ticks to wait for the bits
+ * @return		Value of the event bits when the condition was met or the
+ * 				time expired
+ *
+ * @details		Blocks in a single kernel call until the condition is met, so
+ * 				a task can wait for several events at once, e.g. data ready OR
+ * 				abort OR config change. The bits are only cleared if the
+ * 				condition was met. Test the returned value to find out which
+ * 				bits are set, or if the time expired.
+ * @see			https://www.freertos.org/xEventGroupWaitBits.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::waitBits(EventBits_t bitsToWaitFor, bool waitForAllBits, bool clearOnExit, TickType_t ticksToWait)
+{
+	EventBits_t ret; // Temporary return value
+
+	assert((bitsToWaitFor != 0) && ((bitsToWaitFor & ~usableBits) == 0));
+
+	WRAPPER_TRACE_ENTER(handle, eventGroupWaitBits);
+	ret = xEventGroupWaitBits(	handle,
+								bitsToWaitFor,
+								(clearOnExit == true) ? pdTRUE : pdFALSE,
+								(waitForAllBits == true) ? pdTRUE : pdFALSE,
+								ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, eventGroupWaitBits, ((waitForAllBits == true) ? ((ret & bitsToWaitFor) == bitsToWaitFor) : ((ret & bitsToWaitFor) != 0)));
+
+	return ret;
+}
+
+/**
+ * @brief		Waits for bits with default block time
+ *
+ * @param		bitsToWaitFor	Bits to wait for, must not be 0
+ * @param		waitForAllBits	True to wait for all bits, false to wait for any bit
+ * @param		clearOnExit		True to clear the bits that were waited for on exit
+ * @return		Value of the event bits when the condition was met or the
+ * 				time expired
+ *
+ * @details		Sets the ticksToWait to the defaultBlockTime. By default this
+ * 				is portMAX_DELAY.
+ * @see			https://www.freertos.org/xEventGroupWaitBits.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::waitBits(EventBits_t bitsToWaitFor, bool waitForAllBits, bool clearOnExit)
+{
+	return EventGroup::waitBits(bitsToWaitFor, waitForAllBits, clearOnExit, defaultBlockTime);
+}
+
+/**
+ * @brief		Sets bits and waits for other bits, as a rendezvous
+ *
+ * @param		bitsToSet		Bits to set, usually the bit of the calling task
+ * @param		bitsToWaitFor	Bits of all tasks of the rendezvous
+ * @param		ticksToWait		Ticks to wait for all bits
+ * @return		Value of the event bits when all bits were set or the time
+ * 				expired
+ *
+ * @details		Sets `bitsToSet` and waits for all `bitsToWaitFor` as one
+ * 				atomic operation with the FreeRTOS API function
+ * 				xEventGroupSync(). When all tasks arrived, the bits are
+ * 				cleared, so the rendezvous can be used again. The time expired
+ * 				if not all bits of `bitsToWaitFor` are set in the returned value.
+ * @see			https://www.freertos.org/xEventGroupSync.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::sync(EventBits_t bitsToSet, EventBits_t bitsToWaitFor, TickType_t ticksToWait)
+{
+	EventBits_t ret; // Temporary return value
+
+	assert((bitsToWaitFor != 0) && (((bitsToSet | bitsToWaitFor) & ~usableBits) == 0));
+
+	WRAPPER_TRACE_ENTER(handle, eventGroupSync);
+	ret = xEventGroupSync(handle, bitsToSet, bitsToWaitFor, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, eventGroupSync, ((ret & bitsToWaitFor) == bitsToWaitFor));
+
+	return ret;
+}
+
+/**
+ * @brief		Sets bits and waits for other bits with default block time
+ *
+ * @param		bitsToSet		Bits to set, usually the bit of the calling task
+ * @param		bitsToWaitFor	Bits of all tasks of the rendezvous
+ * @return		Value of the event bits when all bits were set or the time
+ * 				expired
+ *
+ * @details		Sets the ticksToWait to the defaultBlockTime. By default this
+ * 				is portMAX_DELAY.
+ * @see			https://www.freertos.org/xEventGroupSync.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline EventBits_t EventGroup::sync(EventBits_t bitsToSet, EventBits_t bitsToWaitFor)
+{
+	return EventGroup::sync(bitsToSet, bitsToWaitFor, defaultBlockTime);
+}
+
+/**
+ * @brief		Sets the default block time
+ *
+ * @param		newBlockTime	Ticks to wait of waitBits() and sync() without
+ * 								a time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void EventGroup::setDefaultBlockTime(TickType_t newBlockTime)
+{
+	defaultBlockTime = newBlockTime;
+}
+
+/****************************************************************************/
+/* End Header : Event Group Class											*/
+/****************************************************************************/
+#endif /* EVENTGROUP_HPP_ */
@@ -0,0 +1,132 @@
+/****************************************************************************/
+/*  Source    : Benchmark Example											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : BenchmarkMain.cpp											*/
+/*                                                                          */
+/*  @brief	  : Runs the Benchmark on the POSIX/Linux simulator and fails	*/
+/*				if a wrapper exceeds the threshold							*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Usage: benchmark [threshold in percent] [iterations]		*/
+/*				Build it with the FreeRTOS POSIX port (portable/ThirdParty/	*/
+/*				GCC/Posix) and a FreeRTOSConfig.h with						*/
+/*				configSUPPORT_STATIC_ALLOCATION and							*/
+/*				configKERNEL_PROVIDED_STATIC_MEMORY set to 1. The exit code	*/
+/*				is 0 if all cases passed, so it can run as a test in CI.	*/
+/*				The ISR case needs a real interrupt, on the STM32G474 call	*/
+/*				runFromISR() with an unused NVIC interrupt pended by		*/
+/*				`NVIC->STIR` and signalFromISR() in its handler.			*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstdio>
+#include <cstdlib>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "../Benchmark.hpp"
+#include "../Task.hpp"
+
+/* Class constant declaration  */
+#ifndef BENCHMARK_ITERATIONS
+#define BENCHMARK_ITERATIONS		1000	///< Default number of calls per case and variant
+#endif
+
+/* Class data declaration      */
+static uint32_t thresholdPercent = BENCHMARK_THRESHOLD_PERCENT;
+static uint32_t iterations = BENCHMARK_ITERATIONS;
+
+/**
+ * @brief		Prints the results of one case
+ *
+ * @param		name			Name of the case
+ * @param		wrapper			Counts of the wrapper
+ * @param		raw				Counts of the raw API
+ * @param		passed			True if the wrapper is within the threshold
+ * @param		context			Not used
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+static void report(const char *name, const BenchmarkResult &wrapper, const BenchmarkResult &raw, bool passed, void *context)
+{
+	(void) context;
+
+	std::printf("%-24s wrapper min %8lu avg %8lu max %8lu   raw min %8lu avg %8lu max %8lu   %s\n",
+			name,
+			(unsigned long) wrapper.minimum, (unsigned long) wrapper.average(), (unsigned long) wrapper.maximum,
+			(unsigned long) raw.minimum, (unsigned long) raw.average(), (unsigned long) raw.maximum,
+			(passed == true) ? "pass" : "FAIL");
+}
+
+/**
+ * @brief		Task function of the benchmark runner
+ *
+ * @param		parameters		Pointer to the benchmark
+ * @return		void
+ *
+ * @details		Runs all cases, prints the result and ends the process with
+ * 				the result as exit code.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+static void runnerFunction(void *parameters)
+{
+	Benchmark<> *benchmark = static_cast<Benchmark<> *>(parameters); // Benchmark to run
+	bool passed; // Result of all cases
+
+	std::printf("threshold %lu %%, %lu iterations, counts in ns\n", (unsigned long) thresholdPercent, (unsigned long) iterations);
+
+	benchmark->setThreshold(thresholdPercent);
+	passed = benchmark->run(iterations, &report, NULL);
+
+	std::printf("%s\n", (passed == true) ? "PASSED" : "FAILED");
+	std::exit((passed == true) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief		Main function
+ *
+ * @param		argc			Number of arguments
+ * @param		argv			Threshold in percent and number of iterations, both optional
+ * @return		Never returns, the runner task ends the process
+ *
+ * @details		The runner has a lower priority than the partner task of the
+ * 				benchmark, as run() requires.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+int main(int argc, char *argv[])
+{
+	if (argc > 1) {
+		thresholdPercent = (uint32_t) std::strtoul(argv[1], NULL, 10);
+	}
+
+	if (argc > 2) {
+		iterations = (uint32_t) std::strtoul(argv[2], NULL, 10);
+	}
+
+	static Benchmark<> benchmark(tskIDLE_PRIORITY + 2); // Benchmark with its partner task
+	static TaskStatic<configMINIMAL_STACK_SIZE * 2> runner(&runnerFunction, "runner", &benchmark, tskIDLE_PRIORITY + 1); // Task that runs the cases
+
+	vTaskStartScheduler();
+
+	return EXIT_FAILURE;
+}
+
+/****************************************************************************/
+/* End Source : Benchmark Example											*/
+/****************************************************************************/
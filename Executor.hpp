@@ -0,0 +1,445 @@
+#ifndef EXECUTOR_HPP_
+#define EXECUTOR_HPP_
+/****************************************************************************/
+/*  Header    : Executor Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : Executor.hpp												*/
+/*                                                                          */
+/*  @brief	  : Pool of worker tasks running small jobs of priority lanes,	*/
+/*				stored inline in static queues without heap					*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <semphr.h>
+
+#include "FreeRTOS.hpp"
+#include "Queue.hpp"
+#include "Semaphore.hpp"
+#include "Task.hpp"
+
+/* Class constant declaration  */
+#ifndef EXECUTOR_NOTIFY_INDEX
+#define EXECUTOR_NOTIFY_INDEX	(configTASK_NOTIFICATION_ARRAY_ENTRIES - 2)	///< Counts the completions, apart from index 0 and FREERTOS_WAKEUP_NOTIFY_INDEX
+#endif
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes = 2, size_t JobSize = 16, UBaseType_t NotifyIndex = EXECUTOR_NOTIFY_INDEX>
+class Executor : public FreeRTOS
+{
+	static_assert(Workers != 0, "Workers must not be 0");
+	static_assert(Lanes != 0, "Lanes must not be 0");
+	static_assert(QueueLength != 0, "QueueLength must not be 0");
+	static_assert(NotifyIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES, "NotifyIndex out of range");
+
+public:
+	struct Job {
+		void							(*invoke)(void *storage);
+		TaskHandle_t					submitter;
+		alignas(std::max_align_t) uint8_t	storage[JobSize];
+	};
+
+protected:
+	QueueStatic<Job, QueueLength>	lanes[Lanes];
+	SemaphoreStatic					pending;
+	alignas(TaskStatic<StackDepth>) uint8_t	workerStorage[Workers][sizeof(TaskStatic<StackDepth>)];
+
+	TickType_t			defaultMaxTicksToWait = portMAX_DELAY;
+	TickType_t			defaultMinTicksToWait = 0;
+
+	template <typename Callable>
+	void static invoke(void *storage);
+
+	template <typename C>
+	void static prepare(Job &job, C &&callable, TaskHandle_t submitter);
+
+	void static worker(void *parameter);
+
+public:
+	Executor(std::string_view workerName, UBaseType_t workerPriority);
+
+	Executor(const Executor &) = delete;
+	Executor &operator=(const Executor &) = delete;
+
+	template <typename C>
+	bool post(C &&callable, size_t lane, TickType_t ticksToWait);
+	template <typename C, typename Rep, typename Period>
+	bool post(C &&callable, size_t lane, const std::chrono::duration<Rep, Period> timeToWait)	{return post(std::forward<C>(callable), lane, convertToTicks(timeToWait));};
+	template <typename C>
+	bool post(C &&callable, size_t lane = 0)								{return post(std::forward<C>(callable), lane, defaultMinTicksToWait);};
+
+	template <typename C>
+	bool postFromISR(C &&callable, size_t lane, BaseType_t *higherPriorityTaskWoken);
+	template <typename C>
+	bool postFromISR(C &&callable, size_t lane = 0)							{return postFromISR(std::forward<C>(callable), lane, NULL);};
+
+	template <typename C>
+	bool postAndNotify(C &&callable, size_t lane, TickType_t ticksToWait);
+	template <typename C, typename Rep, typename Period>
+	bool postAndNotify(C &&callable, size_t lane, const std::chrono::duration<Rep, Period> timeToWait)	{return postAndNotify(std::forward<C>(callable), lane, convertToTicks(timeToWait));};
+	template <typename C>
+	bool postAndNotify(C &&callable, size_t lane = 0)						{return postAndNotify(std::forward<C>(callable), lane, defaultMinTicksToWait);};
+
+	bool waitForCompletion(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool waitForCompletion(const std::chrono::duration<Rep, Period> timeToWait)	{return waitForCompletion(convertToTicks(timeToWait));};
+	bool waitForCompletion(void);
+
+	UBaseType_t getPending(void)											{return pending.getCount();};
+
+	Task &getWorker(size_t index);
+
+	void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
+
+	void setDefaultMinTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMinTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMinTicksToWait(convertToTicks(newTimeToWait));};
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		workerName			A descriptive name for the worker tasks
+ * @param		workerPriority		The priority at which the workers will execute
+ *
+ * @details		Creates one static queue per lane, a counting semaphore of the
+ * 				queued jobs and `Workers` static tasks, all inside the object.
+ * 				A pool of two workers replaces a task per job type, only the
+ * 				stack of the largest job is needed per worker. The workers are
+ * 				ready when the scheduler starts.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::Executor(	std::string_view workerName,
+																							UBaseType_t workerPriority)
+																							:	pending(Lanes * QueueLength, 0)
+{
+	for (size_t i = 0; i < Workers; i++) {
+		new (workerStorage[i]) TaskStatic<StackDepth>(&Executor::worker, workerName, (void *) this, workerPriority);
+	}
+}
+
+/**
+ * @brief		Calls the callable stored in a job
+ *
+ * @param		storage		Inline storage of the job
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+template <typename Callable>
+inline void Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::invoke(void *storage)
+{
+	(*std::launder(reinterpret_cast<Callable *>(storage)))();
+}
+
+/**
+ * @brief		Stores a callable in a job
+ *
+ * @param		job				Job to prepare
+ * @param		callable		Callable without arguments
+ * @param		submitter		Task to notify after the job ran, NULL for none
+ * @return		void
+ *
+ * @details		The callable is copied into the job, the queue copies the job
+ * 				byte by byte. That's why it has to be trivially copyable, like
+ * 				a lambda capturing pointers and values.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+template <typename C>
+inline void Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::prepare(Job &job, C &&callable, TaskHandle_t submitter)
+{
+	using Callable = std::decay_t<C>;
+
+	static_assert(std::is_invocable_v<Callable &>, "Callable must be invocable without arguments");
+	static_assert(std::is_trivially_copyable_v<Callable>, "Callable must be trivially copyable");
+	static_assert(sizeof(Callable) <= JobSize, "Callable is larger than JobSize");
+	static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable is over aligned");
+
+	job.invoke = &Executor::invoke<Callable>;
+	job.submitter = submitter;
+	new (job.storage) Callable(std::forward<C>(callable));
+}
+
+/**
+ * @brief		Task function of the workers
+ *
+ * @param		parameter		Pointer to the executor
+ * @return		void
+ *
+ * @details		Waits on the semaphore until a job is queued and takes it from
+ * 				the first lane that is not empty, so lane `0` has the highest
+ * 				priority. The semaphore is given after the job was queued, so
+ * 				a worker that took it always finds a job. After the job ran,
+ * 				the submitter is notified if it asked for it.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline void Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::worker(void *parameter)
+{
+	Executor *executor = static_cast<Executor *>(parameter); // Executor of the worker
+	Job job; // Create local buffer
+
+	for (;;) {
+		if (executor->pending.take(portMAX_DELAY) == false) {
+			continue;
+		}
+
+		for (size_t lane = 0; lane < Lanes; lane++) {
+			if (executor->lanes[lane].tryReceive(job, 0) == true) {
+				job.invoke(job.storage);
+
+				if (job.submitter != NULL) {
+					xTaskNotifyGiveIndexed(job.submitter, NotifyIndex);
+				}
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief		Posts a job and waits the given ticks
+ *
+ * @param		callable		Callable without arguments, run by a worker
+ * @param		lane			Lane of the job, `0` has the highest priority
+ * @param		ticksToWait		Ticks to wait if the lane is full
+ * @return		True if the job was queued, false otherwise
+ *
+ * @details		Stores the callable inline in a job and queues it in `lane`,
+ * 				e.g. `executor.post([&flash, page] { flash.write(page); });`.
+ * 				Jobs of one lane run in order of posting, with more than one
+ * 				worker they may run concurrently.
+ * @warning		The callable must be trivially copyable and fit into `JobSize`
+ * 				bytes, everything it captures by reference has to outlive the
+ * 				job.
+ * @see			https://www.freertos.org/xQueueSendToBack.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+template <typename C>
+inline bool Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::post(C &&callable, size_t lane, TickType_t ticksToWait)
+{
+	Job job; // Create local buffer
+
+	assert(lane < Lanes);
+
+	prepare(job, std::forward<C>(callable), NULL);
+
+	if (lanes[lane].sendToBack(job, ticksToWait) == false) {
+		return false;
+	}
+
+	return pending.give();
+}
+
+/**
+ * @brief		Posts a job from an ISR
+ *
+ * @param		callable					Callable without arguments, run by a worker
+ * @param		lane						Lane of the job, `0` has the highest priority
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if the job was queued, false if the lane is full
+ *
+ * @details		Queues a job from an interrupt service routine, it has no
+ * 				delay because it doesn't block. Defers the work of an ISR to
+ * 				the workers without a dedicated task.
+ * @see			https://www.freertos.org/xQueueSendToBackFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+template <typename C>
+inline bool Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::postFromISR(C &&callable, size_t lane, BaseType_t *higherPriorityTaskWoken)
+{
+	Job job; // Create local buffer
+
+	assert(lane < Lanes);
+
+	prepare(job, std::forward<C>(callable), NULL);
+
+	if (lanes[lane].sendToBackFromISR(job, higherPriorityTaskWoken) == false) {
+		return false;
+	}
+
+	return pending.giveFromISR(higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Posts a job that notifies the calling task when it's done
+ *
+ * @param		callable		Callable without arguments, run by a worker
+ * @param		lane			Lane of the job, `0` has the highest priority
+ * @param		ticksToWait		Ticks to wait if the lane is full
+ * @return		True if the job was queued, false otherwise
+ *
+ * @details		Same as post(), after the job ran the worker gives the task
+ * 				notification `NotifyIndex` of the calling task. Wait for it
+ * 				with waitForCompletion().
+ * @see			https://www.freertos.org/xTaskNotifyGive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+template <typename C>
+inline bool Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::postAndNotify(C &&callable, size_t lane, TickType_t ticksToWait)
+{
+	Job job; // Create local buffer
+
+	assert(lane < Lanes);
+
+	prepare(job, std::forward<C>(callable), xTaskGetCurrentTaskHandle());
+
+	if (lanes[lane].sendToBack(job, ticksToWait) == false) {
+		return false;
+	}
+
+	return pending.give();
+}
+
+/**
+ * @brief		Waits for a job posted with postAndNotify() and the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if a job completed, false if the time expired
+ *
+ * @details		Takes one completion of the notification `NotifyIndex`, so
+ * 				after posting three jobs it's called three times. The
+ * 				completions are counted, so `NotifyIndex` defaults to
+ * 				EXECUTOR_NOTIFY_INDEX. Neither the default index 0 nor
+ * 				FREERTOS_WAKEUP_NOTIFY_INDEX, whose takes clear the count, may
+ * 				be used. With fewer than three notification entries it has to
+ * 				be set explicitly.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline bool Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::waitForCompletion(TickType_t ticksToWait)
+{
+	return (ulTaskNotifyTakeIndexed(NotifyIndex, pdFALSE, ticksToWait) != 0) ? true : false;
+}
+
+/**
+ * @brief		Waits for a job posted with postAndNotify() and the default ticks
+ *
+ * @param		void
+ * @return		True if a job completed, false if the time expired
+ *
+ * @details		The default value is `portMAX_DELAY`, so it waits the maximum
+ * 				of time.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline bool Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::waitForCompletion(void)
+{
+	return waitForCompletion(defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Gets a worker task
+ *
+ * @param		index		Index of the worker
+ * @return		Reference to the worker task
+ *
+ * @details		Gives access to e.g. the stack high water mark of a worker.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline Task &Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::getWorker(size_t index)
+{
+	assert(index < Workers);
+
+	return *std::launder(reinterpret_cast<TaskStatic<StackDepth> *>(workerStorage[index]));
+}
+
+/**
+ * @brief		Used to set the default max ticks
+ *
+ * @param		newTicksToWait	New value for the `defaultMaxTicksToWait`
+ * @return		void
+ *
+ * @details		Sets the new default ticks used by waitForCompletion(). The
+ * 				value is initialized to `portMAX_DELAY`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline void Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::setDefaultMaxTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMaxTicksToWait = newTicksToWait;
+}
+
+/**
+ * @brief		Used to set the default min ticks
+ *
+ * @param		newTicksToWait	New value for the `defaultMinTicksToWait`
+ * @return		void
+ *
+ * @details		Sets the new default ticks used by post() and postAndNotify().
+ * 				The value is initialized to `0`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Workers, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t QueueLength, size_t Lanes, size_t JobSize, UBaseType_t NotifyIndex>
+inline void Executor<Workers, StackDepth, QueueLength, Lanes, JobSize, NotifyIndex>::setDefaultMinTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMinTicksToWait = newTicksToWait;
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Executor Class												*/
+/****************************************************************************/
+#endif /* EXECUTOR_HPP_ */
@@ -16,6 +16,16 @@
 /* 				- 10.04.2023	NZ	Mod: Header, add doxygen commands		*/
 /* 				- 24.04.2023	NZ	Mod: Moved some methods from declaration*/
 /*									down to the definition section			*/
+/*				- 14.10.2026	NZ	Add: copyName() for heap free names		*/
+/*				- 14.10.2026	NZ	Mod: One constexpr convertToTicks() for	*/
+/*									every duration with rounding and		*/
+/*									saturation, convertToTime() as member	*/
+/*				- 14.10.2026	NZ	Add: disableInterrupts() and			*/
+/*									enableInterrupts(), critical sections	*/
+/*									in CriticalSection.hpp					*/
+/*				- 14.10.2026	NZ	Add: stepTick() and catchUpTicks()		*/
+/*				- 14.10.2026	NZ	Mod: suspendAll() documented for SMP	*/
+/*				- 14.10.2026	NZ	Add: FREERTOS_WAKEUP_NOTIFY_INDEX		*/
 /*																			*/
 /*  @todo	  :	- Add this functions from API								*/
 /*					- uxTaskPriorityGet()									*/
@@ -27,14 +37,6 @@
 /*					- uxTaskGetNumberOfTasks()								*/
 /*					- vTaskList()											*/
 /*					- vTaskGetRunTimeStats()								*/
-/*					- taskENTER_CRITICAL()									*/
-/*					- taskEXIT_CRITICAL()									*/
-/*					- taskENTER_CRITICAL_FROM_ISR()							*/
-/*					- taskEXIT_CRITICAL_FROM_ISR()							*/
-/*					- taskDISABLE_INTERRUPTS()								*/
-/*					- taskENABLE_INTERRUPTS()								*/
-/*					- vTaskStepTick()										*/
-/*					- xTaskCatchUpTicks()									*/
 /*																			*/
 /****************************************************************************/
 /*																			*/
@@ -42,11 +44,17 @@
 
 /* imports */
 #include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 #include <FreeRTOS.h>
 #include <task.h>
 
 /* Class constant declaration  */
+#ifndef FREERTOS_WAKEUP_NOTIFY_INDEX
+#define FREERTOS_WAKEUP_NOTIFY_INDEX	(configTASK_NOTIFICATION_ARRAY_ENTRIES - 1)	///< Notification index of the internal wake-ups, not the default index 0
+#endif
 
 /* Class Type declaration      */
 
@@ -63,130 +71,218 @@ public:
 
 	void static endScheduler(void)											{vTaskEndScheduler();};
 
-	void static suspendAll(void)											{vTaskSuspendAll();};
+	void static suspendAll(void);
 
 	bool static resumeAll(void);
 
-	TickType_t static convertToTicks(const std::chrono::milliseconds msec);
-	TickType_t static convertToTicks(const std::chrono::seconds sec);
-	TickType_t static convertToTicks(const std::chrono::minutes minutes);
-	TickType_t static convertToTicks(const std::chrono::hours hours);
+	void static disableInterrupts(void)										{taskDISABLE_INTERRUPTS();};
 
-	std::chrono::milliseconds static convertToTime(const TickType_t ticks);
+	void static enableInterrupts(void)										{taskENABLE_INTERRUPTS();};
+
+#if (configUSE_TICKLESS_IDLE != 0)
+	void static stepTick(TickType_t ticksToJump)							{vTaskStepTick(ticksToJump);};
+#endif
+
+	bool static catchUpTicks(TickType_t ticksToCatchUp);
+
+	enum class Rounding
+	{
+		ceil,
+		floor,
+		nearest
+	};
+
+	template <typename Rep, typename Period>
+	constexpr TickType_t static convertToTicks(const std::chrono::duration<Rep, Period> duration, const Rounding rounding = Rounding::ceil);
+
+	constexpr std::chrono::milliseconds static convertToTime(const TickType_t ticks);
+
+protected:
+	void static copyName(char *destination, size_t destinationSize, std::string_view source);
 };
 
 /**
- * @brief		Resumes the scheduler
+ * @brief		Suspends the scheduler
  *
  * @param		void
- * @return		True if it was successful, false otherwise
+ * @return		void
  *
- * @details		Resumes the scheduler after it was suspended using a call to
- * 				suspendAll().
- * @warning		resumeAll() only resumes the scheduler. It does not unsuspend
- * 				tasks that were previously suspended by a call to suspend().
- * @see			https://www.freertos.org/a00135.html
+ * @details		Suspends the scheduler without disabling interrupts, context
+ * 				switches don't occur until resumeAll() is called.
+ * @warning		With more than one core the scheduler of all cores is
+ * 				suspended and the lock of the kernel is taken, so tasks on
+ * 				the other cores can't switch either. To keep a task on its
+ * 				core without stopping the other cores, use
+ * 				Task::disablePreemption() instead.
+ * @see			https://www.freertos.org/a00134.html
  *
  * @author		N. Zoller (NZ)
- * @date		24.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  * @remark		Last Modifications:
  * 				- none
  ****************************************************************************/
-inline bool FreeRTOS::resumeAll(void)
+inline void FreeRTOS::suspendAll(void)
 {
-	return (xTaskResumeAll() == pdTRUE) ? true : false;
+	vTaskSuspendAll();
 }
 
 /**
- * @brief		Convention to ticks from ms
+ * @brief		Resumes the scheduler
  *
- * @param		msec			Time in milliseconds
- * @return		Time in ticks
+ * @param		void
+ * @return		True if it was successful, false otherwise
  *
- * @details		Converts milliseconds from the `chrono`-Library to ticks.
+ * @details		Resumes the scheduler after it was suspended using a call to
+ * 				suspendAll().
+ * @warning		resumeAll() only resumes the scheduler. It does not unsuspend
+ * 				tasks that were previously suspended by a call to suspend().
+ * @see			https://www.freertos.org/a00135.html
  *
  * @author		N. Zoller (NZ)
  * @date		24.04.2023	NZ	Created
  * @remark		Last Modifications:
  * 				- none
  ****************************************************************************/
-inline TickType_t FreeRTOS::convertToTicks(const std::chrono::milliseconds msec)
+inline bool FreeRTOS::resumeAll(void)
 {
-	return msec.count() / portTICK_PERIOD_MS;
+	return (xTaskResumeAll() == pdTRUE) ? true : false;
 }
 
 /**
- * @brief		Convention to ticks from s
+ * @brief		Corrects the tick count after a period with a stopped tick
  *
- * @param		sec			Time in seconds
- * @return		Time in ticks
+ * @param		ticksToCatchUp	Number of ticks that were missed
+ * @return		True if a context switch should be performed, false otherwise
  *
- * @details		Converts seconds from the `chrono`-Library to ticks.
+ * @details		Adds the missed ticks to the tick count and unblocks the tasks
+ * 				whose timeout expired meanwhile, e.g. after the tick interrupt
+ * 				was disabled for a flash erase. Unlike stepTick() it may be
+ * 				called from a task and not only from the tickless idle hook.
+ * @see			https://www.freertos.org/vTaskStepTick.html
  *
  * @author		N. Zoller (NZ)
- * @date		24.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  * @remark		Last Modifications:
  * 				- none
  ****************************************************************************/
-inline TickType_t FreeRTOS::convertToTicks(const std::chrono::seconds sec)
+inline bool FreeRTOS::catchUpTicks(TickType_t ticksToCatchUp)
 {
-	return sec.count() * 1000 / portTICK_PERIOD_MS;
+	return (xTaskCatchUpTicks(ticksToCatchUp) == pdTRUE) ? true : false;
 }
 
 /**
- * @brief		Convention to ticks from min
+ * @brief		Conversion to ticks from any duration
  *
- * @param		min			Time in minutes
+ * @param		duration		Time as a duration from the `chrono`-Library
+ * @param		rounding		How a remainder of a tick is rounded, ceil as default
  * @return		Time in ticks
  *
- * @details		Converts minutes from the `chrono`-Library to ticks.
+ * @details		Converts every `std::chrono::duration` to ticks with the ratio
+ * 				of `configTICK_RATE_HZ`, so it also works with tick rates
+ * 				above 1000 Hz. The default rounds up, so a timeout never
+ * 				becomes shorter than requested and `500us` is one tick and not
+ * 				zero. Negative durations give zero ticks, durations that don't
+ * 				fit into `TickType_t` saturate to `portMAX_DELAY`. Constant
+ * 				durations are converted at compile time, e.g.
+ * 				`queue.receive(20ms)` costs no division at runtime.
+ * @warning		`portMAX_DELAY` waits forever if `INCLUDE_vTaskSuspend` is 1.
  *
  * @author		N. Zoller (NZ)
  * @date		24.04.2023	NZ	Created
  * @remark		Last Modifications:
- * 				- none
+ * 				- 14.10.2026	NZ	Mod: One template for every duration,
+ * 									rounding and saturation
  ****************************************************************************/
-inline TickType_t FreeRTOS::convertToTicks(const std::chrono::minutes minutes)
+template <typename Rep, typename Period>
+inline constexpr TickType_t FreeRTOS::convertToTicks(const std::chrono::duration<Rep, Period> duration, const Rounding rounding)
 {
-	return minutes.count() * 60 * 1000 / portTICK_PERIOD_MS;
+	using Factor = std::ratio_divide<Period, std::ratio<1, configTICK_RATE_HZ>>; // Ticks per unit of the duration
+
+	if (duration.count() <= 0) {
+		return 0;
+	}
+
+	if constexpr (std::is_floating_point_v<Rep>) {
+		long double exact = (long double) duration.count() * Factor::num / Factor::den;
+
+		if (exact >= (long double) portMAX_DELAY) {
+			return portMAX_DELAY;
+		}
+
+		TickType_t ticks = (TickType_t) exact;
+
+		if ((rounding == Rounding::ceil) && (exact > ticks)) {
+			ticks++;
+		} else if ((rounding == Rounding::nearest) && ((exact - ticks) >= 0.5L)) {
+			ticks++;
+		}
+
+		return ticks;
+	} else {
+		uintmax_t value = (uintmax_t) duration.count();
+
+		if (value > (UINTMAX_MAX / Factor::num)) {
+			return portMAX_DELAY;
+		}
+
+		value *= Factor::num;
+
+		uintmax_t ticks = value / Factor::den;
+		uintmax_t remainder = value % Factor::den;
+
+		if ((rounding == Rounding::ceil) && (remainder != 0)) {
+			ticks++;
+		} else if ((rounding == Rounding::nearest) && (remainder >= (Factor::den - remainder))) {
+			ticks++;
+		}
+
+		return (ticks >= portMAX_DELAY) ? portMAX_DELAY : (TickType_t) ticks;
+	}
 }
 
 /**
- * @brief		Convention to ticks from h
+ * @brief		Conversion to ms from ticks
  *
- * @param		h			Time in hours
- * @return		Time in ticks
+ * @param		ticks			Time in ticks
+ * @return		Time in milliseconds
  *
- * @details		Converts hours from the `chrono`-Library to ticks.
+ * @details		Converts ticks from the FreeRTOS-Library to milliseconds from
+ * 				the `chrono`-Library. From there other conventions from the
+ * 				`chrono`-Library could be used.
  *
  * @author		N. Zoller (NZ)
  * @date		24.04.2023	NZ	Created
  * @remark		Last Modifications:
- * 				- none
+ * 				- 14.10.2026	NZ	Mod: Member instead of a free function,
+ * 									constexpr with the ratio of the tick rate
  ****************************************************************************/
-inline TickType_t FreeRTOS::convertToTicks(const std::chrono::hours hours)
+inline constexpr std::chrono::milliseconds FreeRTOS::convertToTime(const TickType_t ticks)
 {
-	return hours.count() * 60 * 60 * 1000 / portTICK_PERIOD_MS;
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<uintmax_t, std::ratio<1, configTICK_RATE_HZ>>(ticks));
 }
 
 /**
- * @brief		Convention to ms from ticks
+ * @brief		Copies a name into a fixed size buffer
  *
- * @param		ticks			Time in ticks
- * @return		Time in milliseconds
+ * @param		destination		Buffer to store the name in
+ * @param		destinationSize	Size of the buffer in bytes
+ * @param		source			Name to copy
+ * @return		void
  *
- * @details		Converts ticks from the FreeRTOS-Library to milliseconds from
- * 				the `chrono`-Library. From there other conventions from the
- * 				`chrono`-Library could be used.
+ * @details		Copies the name into the buffer and terminates it with `\0`.
+ * 				Names longer than the buffer are truncated, like FreeRTOS does
+ * 				with task names longer than `configMAX_TASK_NAME_LEN`. Used by
+ * 				the wrappers to store names without any heap allocation.
  *
  * @author		N. Zoller (NZ)
- * @date		24.04.2023	NZ	Created
- * @remark		Last Modifications:
- * 				- none
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline std::chrono::milliseconds static convertToTime(const TickType_t ticks)
+inline void FreeRTOS::copyName(char *destination, size_t destinationSize, std::string_view source)
 {
-	return std::chrono::milliseconds(ticks * portTICK_PERIOD_MS);
+	size_t length = (source.size() < destinationSize) ? source.size() : destinationSize - 1;
+
+	source.copy(destination, length);
+	destination[length] = '\0';
 }
 /****************************************************************************/
 /* End Header : FreeRTOS Class												*/
@@ -0,0 +1,113 @@
+#ifndef ISRCONTEXT_HPP_
+#define ISRCONTEXT_HPP_
+/****************************************************************************/
+/*  Header    : ISR Context Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : IsrContext.hpp												*/
+/*                                                                          */
+/*  @brief	  : Collects the woken flag of FromISR calls and yields once	*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class IsrContext
+{
+protected:
+	BaseType_t				higherPriorityTaskWoken = pdFALSE;
+
+public:
+	IsrContext(void) {};
+
+	~IsrContext(void);
+
+	IsrContext(const IsrContext &) = delete;
+	IsrContext &operator=(const IsrContext &) = delete;
+
+	operator BaseType_t *(void);
+
+	bool isYieldRequired(void);
+};
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Requests a context switch with portYIELD_FROM_ISR() if one of
+ * 				the FromISR calls in this scope has woken a task with a higher
+ * 				priority than the interrupted one. So the woken task runs
+ * 				directly after the ISR and not at the next tick.
+ * @warning		The object must be created in the ISR itself and go out of
+ * 				scope at the end of it, after the last FromISR call.
+ * @see			https://www.freertos.org/a00090.html#portYIELD_FROM_ISR
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline IsrContext::~IsrContext(void)
+{
+	portYIELD_FROM_ISR(higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Conversion to the woken flag
+ *
+ * @param		void
+ * @return		Pointer to the collected woken flag
+ *
+ * @details		Allows to pass the context directly as the
+ * 				`higherPriorityTaskWoken` parameter of the FromISR methods,
+ * 				e.g. `queue.sendToBackFromISR(item, isr)`. FreeRTOS only ever
+ * 				sets the flag to pdTRUE, so several calls can share it.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline IsrContext::operator BaseType_t *(void)
+{
+	return &higherPriorityTaskWoken;
+}
+
+/**
+ * @brief		Checks if a context switch will be requested
+ *
+ * @param		void
+ * @return		True if a context switch is requested on exit, false otherwise
+ *
+ * @details		Returns if one of the FromISR calls so far has woken a task
+ * 				with a higher priority than the interrupted one.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool IsrContext::isYieldRequired(void)
+{
+	return (higherPriorityTaskWoken == pdTRUE) ? true : false;
+}
+
+/****************************************************************************/
+/* End Header : ISR Context Class											*/
+/****************************************************************************/
+#endif /* ISRCONTEXT_HPP_ */
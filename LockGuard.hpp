@@ -0,0 +1,134 @@
+#ifndef LOCKGUARD_HPP_
+#define LOCKGUARD_HPP_
+/****************************************************************************/
+/*  Header    : Lock Guard Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : LockGuard.hpp												*/
+/*                                                                          */
+/*  @brief	  : RAII lock for the Mutex and MutexRecursive class			*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+
+#include <FreeRTOS.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+template <typename MutexType>
+class LockGuard
+{
+protected:
+	MutexType				&mutex;
+	const bool				locked;
+
+public:
+	LockGuard(MutexType &lockMutex);
+	LockGuard(MutexType &lockMutex, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	LockGuard(MutexType &lockMutex, const std::chrono::duration<Rep, Period> timeToWait): LockGuard(lockMutex, FreeRTOS::convertToTicks(timeToWait)) {};
+
+	~LockGuard(void);
+
+	LockGuard(const LockGuard &) = delete;
+	LockGuard &operator=(const LockGuard &) = delete;
+
+	bool isLocked(void);
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		lockMutex		Mutex to take
+ *
+ * @details		Takes the mutex and waits as long as needed (`portMAX_DELAY`).
+ * 				The mutex is given back when the object goes out of scope.
+ * @see			https://www.freertos.org/a00122.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename MutexType>
+inline LockGuard<MutexType>::LockGuard(MutexType &lockMutex): mutex(lockMutex), locked(lockMutex.take(portMAX_DELAY))
+{
+};
+
+/**
+ * @brief		Constructor, with timeout
+ *
+ * @param		lockMutex		Mutex to take
+ * @param		ticksToWait		Ticks to wait for the mutex to become available
+ *
+ * @details		Tries to take the mutex within the given ticks. Check with
+ * 				isLocked() if the mutex was obtained, only then it is given
+ * 				back when the object goes out of scope.
+ * @see			https://www.freertos.org/a00122.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename MutexType>
+inline LockGuard<MutexType>::LockGuard(MutexType &lockMutex, TickType_t ticksToWait): mutex(lockMutex), locked(lockMutex.take(ticksToWait))
+{
+};
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Gives the mutex back, if it was obtained by the constructor.
+ * @see			https://www.freertos.org/a00123.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename MutexType>
+inline LockGuard<MutexType>::~LockGuard(void)
+{
+	if (locked == true) {
+		mutex.give();
+	}
+};
+
+/**
+ * @brief		Checks if the mutex is held
+ *
+ * @param		void
+ * @return		True if the mutex was obtained, false if the timeout expired
+ *
+ * @details		Returns if the constructor was able to take the mutex.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename MutexType>
+inline bool LockGuard<MutexType>::isLocked(void)
+{
+	return locked;
+}
+
+/****************************************************************************/
+/* End Header : Lock Guard Class											*/
+/****************************************************************************/
+#endif /* LOCKGUARD_HPP_ */
@@ -0,0 +1,223 @@
+#ifndef LOCKSTATISTICS_HPP_
+#define LOCKSTATISTICS_HPP_
+/****************************************************************************/
+/*  Header    : Lock Statistics Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : LockStatistics.hpp											*/
+/*                                                                          */
+/*  @brief	  : Opt-in contention statistics for Semaphore, Mutex and		*/
+/*				MutexRecursive												*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstdint>
+#include <utility>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+template <typename LockType>
+class LockStatistics : public LockType
+{
+protected:
+	uint32_t						takeCount = 0;
+	uint32_t						contendedCount = 0;
+	uint32_t						timeoutCount = 0;
+	uint32_t						totalWaitTime = 0;
+	TickType_t						maxWaitTime = 0;
+	TickType_t						maxHoldTime = 0;
+	TickType_t						holdStartTime = 0;
+	UBaseType_t						holdDepth = 0;
+	TaskHandle_t					lastHolder = NULL;
+
+public:
+	template <typename... Args>
+	LockStatistics(Args &&... args): LockType(std::forward<Args>(args)...) {};
+
+	bool take(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool take(const std::chrono::duration<Rep, Period> timeToWait)			{return take(FreeRTOS::convertToTicks(timeToWait));};
+	bool take(void);
+
+	bool give(void);
+
+	uint32_t getTakeCount(void)												{return takeCount;};
+	uint32_t getContendedCount(void)										{return contendedCount;};
+	uint32_t getTimeoutCount(void)											{return timeoutCount;};
+	TickType_t getMaxWaitTime(void)											{return maxWaitTime;};
+	TickType_t getMaxHoldTime(void)											{return maxHoldTime;};
+	TaskHandle_t getLastHolder(void)										{return lastHolder;};
+
+	TickType_t getAverageWaitTime(void);
+
+	void resetStatistics(void);
+};
+
+/**
+ * @brief		Takes the lock and waits the given ticks, with statistics
+ *
+ * @param		ticksToWait		Ticks to wait for the lock to become available
+ * @return		True if the lock was obtained, false if the time expired
+ *
+ * @details		First tries to take the lock without blocking. If that fails,
+ * 				the take is counted as contended and it waits the given ticks.
+ * 				The wait time is measured in ticks, a timeout is counted if
+ * 				the lock was still not obtained. For a MutexRecursive only the
+ * 				outermost take starts the hold time.
+ * @warning		Only the task methods are counted, not takeFromISR().
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename LockType>
+inline bool LockStatistics<LockType>::take(TickType_t ticksToWait)
+{
+	TickType_t startTime; // Start of the wait
+	TickType_t waitTime = 0; // Ticks waited for the lock
+	bool ret = LockType::take((TickType_t) 0); // Temporary return value
+	bool contended = (ret == false); // Lock was not available at once
+
+	if ((contended == true) && (ticksToWait != 0)) {
+		startTime = xTaskGetTickCount();
+		ret = LockType::take(ticksToWait);
+		waitTime = xTaskGetTickCount() - startTime;
+	}
+
+	taskENTER_CRITICAL();
+	takeCount++;
+
+	if (contended == true) {
+		contendedCount++;
+	}
+
+	totalWaitTime += waitTime;
+
+	if (waitTime > maxWaitTime) {
+		maxWaitTime = waitTime;
+	}
+
+	if (ret == false) {
+		timeoutCount++;
+	} else if (holdDepth++ == 0) {
+		holdStartTime = xTaskGetTickCount();
+		lastHolder = xTaskGetCurrentTaskHandle();
+	}
+	taskEXIT_CRITICAL();
+
+	return ret;
+}
+
+/**
+ * @brief		Takes the lock and waits the default ticks, with statistics
+ *
+ * @param		void
+ * @return		True if the lock was obtained, false if the time expired
+ *
+ * @details		Takes the lock with the default block time of the lock.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename LockType>
+inline bool LockStatistics<LockType>::take(void)
+{
+	return LockStatistics<LockType>::take(this->defaultBlockTime);
+}
+
+/**
+ * @brief		Gives the lock back, with statistics
+ *
+ * @param		void
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Gives the lock back. When the outermost take is released, the
+ * 				hold time since that take is compared to the maximum.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename LockType>
+inline bool LockStatistics<LockType>::give(void)
+{
+	TickType_t holdTime; // Ticks the lock was held
+
+	taskENTER_CRITICAL();
+	if ((holdDepth != 0) && (--holdDepth == 0)) {
+		holdTime = xTaskGetTickCount() - holdStartTime;
+
+		if (holdTime > maxHoldTime) {
+			maxHoldTime = holdTime;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return LockType::give();
+}
+
+/**
+ * @brief		Gets the average wait time
+ *
+ * @param		void
+ * @return		Average ticks waited per take, uncontended takes included
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename LockType>
+inline TickType_t LockStatistics<LockType>::getAverageWaitTime(void)
+{
+	return (takeCount == 0) ? 0 : (TickType_t) (totalWaitTime / takeCount);
+}
+
+/**
+ * @brief		Resets the statistics
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Sets all counters and maximums back to zero. The hold state
+ * 				of the lock is kept, so a held lock is still measured.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename LockType>
+inline void LockStatistics<LockType>::resetStatistics(void)
+{
+	taskENTER_CRITICAL();
+	takeCount = 0;
+	contendedCount = 0;
+	timeoutCount = 0;
+	totalWaitTime = 0;
+	maxWaitTime = 0;
+	maxHoldTime = 0;
+	taskEXIT_CRITICAL();
+}
+
+/****************************************************************************/
+/* End Header : Lock Statistics Class										*/
+/****************************************************************************/
+#endif /* LOCKSTATISTICS_HPP_ */
@@ -0,0 +1,124 @@
+#ifndef MAILBOX_HPP_
+#define MAILBOX_HPP_
+/****************************************************************************/
+/*  Header    : Mailbox Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : Mailbox.hpp													*/
+/*                                                                          */
+/*  @brief	  : Queue of length one where the latest value wins				*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <string_view>
+
+#include <FreeRTOS.h>
+#include <queue.h>
+
+#include "Queue.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename T>
+class Mailbox : public QueueStatic<T, 1>
+{
+public:
+	Mailbox(void) {};
+	Mailbox(std::string_view mailboxName): QueueStatic<T, 1>(true, mailboxName) {};
+
+	void overwrite(const T itemToQueue);
+
+	void overwriteFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken);
+	void overwriteFromISR(const T itemToQueue);
+};
+
+/**
+ * @brief		Writes the item into the mailbox
+ *
+ * @param		itemToQueue		Item to store
+ * @return		void
+ *
+ * @details		Stores the item with the FreeRTOS API function
+ * 				xQueueOverwrite(). A value that was not yet read is replaced,
+ * 				so the writer never blocks and readers never get a stale
+ * 				value. Read the latest value with peek(), which leaves it in
+ * 				the mailbox, or with receive(), which removes it.
+ * @see			https://www.freertos.org/xQueueOverwrite.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void Mailbox<T>::overwrite(const T itemToQueue)
+{
+	xQueueOverwrite(this->handle, (void *) &itemToQueue);
+}
+
+/**
+ * @brief		Writes the item into the mailbox from an ISR
+ *
+ * @param		itemToQueue					Item to store
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Stores the item with the FreeRTOS API function
+ * 				xQueueOverwriteFromISR(), a value that was not yet read is
+ * 				replaced. If writing unblocks a task with a higher priority
+ * 				than the interrupted one, `higherPriorityTaskWoken` is set to
+ * 				pdTRUE.
+ * @see			https://www.freertos.org/xQueueOverwriteFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void Mailbox<T>::overwriteFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken)
+{
+	xQueueOverwriteFromISR(this->handle, (void *) &itemToQueue, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Writes the item into the mailbox from an ISR
+ *
+ * @param		itemToQueue		Item to store
+ * @return		void
+ *
+ * @details		Stores the item from an interrupt service routine, a value
+ * 				that was not yet read is replaced.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xQueueOverwriteFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void Mailbox<T>::overwriteFromISR(const T itemToQueue)
+{
+	Mailbox<T>::overwriteFromISR(itemToQueue, NULL);
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Mailbox Class												*/
+/****************************************************************************/
+#endif /* MAILBOX_HPP_ */
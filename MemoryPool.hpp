@@ -0,0 +1,561 @@
+#ifndef MEMORYPOOL_HPP_
+#define MEMORYPOOL_HPP_
+/****************************************************************************/
+/*  Header    : Memory Pool Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : MemoryPool.hpp												*/
+/*                                                                          */
+/*  @brief	  : Constant time pool of fixed size blocks, with an allocator	*/
+/*				for containers and an owning pointer for queues				*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class MemoryPoolBase
+{
+protected:
+	struct FreeBlock
+	{
+		FreeBlock					*next;
+	};
+
+	uint8_t							*const storage;
+	const size_t					blockSize;
+	const size_t					count;
+
+	FreeBlock						*freeList = NULL;
+	size_t							freeCount = 0;
+	size_t							minFreeCount = 0;
+	uint32_t						failedCount = 0;
+
+	MemoryPoolBase(uint8_t *poolStorage, size_t poolBlockSize, size_t poolCount)
+		: storage(poolStorage), blockSize(poolBlockSize), count(poolCount) {};
+
+	void initialize(void);
+
+	void *allocateInCritical(void);
+	void freeInCritical(void *block);
+
+public:
+	MemoryPoolBase(const MemoryPoolBase &) = delete;
+	MemoryPoolBase &operator=(const MemoryPoolBase &) = delete;
+
+	void *allocate(void);
+	void *allocateFromISR(void);
+
+	void free(void *block);
+	void freeFromISR(void *block);
+
+	template <typename T, typename... Args>
+	T *create(Args &&... args);
+	template <typename T>
+	void destroy(T *object);
+
+	bool isFromPool(const void *block);
+
+	size_t getBlockSize(void)												{return blockSize;};
+	size_t getCount(void)													{return count;};
+	size_t getFreeCount(void)												{return freeCount;};
+	size_t getUsedCount(void)												{return count - freeCount;};
+	size_t getMinFreeCount(void)											{return minFreeCount;};
+	uint32_t getFailedCount(void)											{return failedCount;};
+};
+
+/* Class definition            */
+template <size_t BlockSize, size_t Count>
+class MemoryPool : public MemoryPoolBase
+{
+	static_assert((BlockSize != 0) && (Count != 0), "BlockSize and Count must not be 0");
+
+public:
+	static constexpr size_t alignedBlockSize = ((((BlockSize > sizeof(FreeBlock)) ? BlockSize : sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+
+protected:
+	alignas(std::max_align_t) uint8_t	blocks[alignedBlockSize * Count];
+
+public:
+	MemoryPool(void);
+};
+
+/* Class definition            */
+template <typename T>
+class PoolAllocator
+{
+	static_assert(alignof(T) <= alignof(std::max_align_t), "T is over aligned for the pool");
+
+	template <typename U>
+	friend class PoolAllocator;
+
+protected:
+	MemoryPoolBase					*pool;
+
+public:
+	using value_type = T;
+
+	PoolAllocator(MemoryPoolBase &blockPool): pool(&blockPool) {};
+	template <typename U>
+	PoolAllocator(const PoolAllocator<U> &other): pool(other.pool) {};
+
+	T *allocate(size_t n);
+	void deallocate(T *p, size_t n);
+
+	template <typename U>
+	bool operator==(const PoolAllocator<U> &other) const					{return pool == other.pool;};
+	template <typename U>
+	bool operator!=(const PoolAllocator<U> &other) const					{return pool != other.pool;};
+};
+
+/* Class definition            */
+template <typename T>
+class PoolPointer
+{
+protected:
+	MemoryPoolBase					*pool = NULL;
+	T								*object = NULL;
+
+public:
+	PoolPointer(void) {};
+	PoolPointer(MemoryPoolBase &blockPool, T *poolObject): pool(&blockPool), object(poolObject) {};
+	PoolPointer(PoolPointer &&other): pool(other.pool), object(other.detach()) {};
+
+	~PoolPointer(void)														{release();};
+
+	PoolPointer(const PoolPointer &) = delete;
+	PoolPointer &operator=(const PoolPointer &) = delete;
+	PoolPointer &operator=(PoolPointer &&other);
+
+	void release(void);
+	void releaseFromISR(void);
+
+	T *detach(void);
+
+	T *get(void)															{return object;};
+	T *operator->(void)														{return object;};
+	T &operator*(void)														{return *object;};
+
+	explicit operator bool(void) const										{return (object != NULL) ? true : false;};
+};
+
+/**
+ * @brief		Links all blocks into the free list
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Called by the constructor of the derived class, when the
+ * 				storage exists.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MemoryPoolBase::initialize(void)
+{
+	FreeBlock *block; // Block to link
+
+	for (size_t i = count; i > 0; i--) {
+		block = new (&storage[(i - 1) * blockSize]) FreeBlock;
+		block->next = freeList;
+		freeList = block;
+	}
+
+	freeCount = count;
+	minFreeCount = count;
+}
+
+/**
+ * @brief		Takes the first block of the free list, in a critical section
+ *
+ * @param		void
+ * @return		Pointer to the block, NULL if the pool is empty
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void *MemoryPoolBase::allocateInCritical(void)
+{
+	FreeBlock *block = freeList; // First free block
+
+	if (block == NULL) {
+		failedCount++;
+		return NULL;
+	}
+
+	freeList = block->next;
+	freeCount--;
+
+	if (freeCount < minFreeCount) {
+		minFreeCount = freeCount;
+	}
+
+	return block;
+}
+
+/**
+ * @brief		Puts a block back on the free list, in a critical section
+ *
+ * @param		block			Block of this pool
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MemoryPoolBase::freeInCritical(void *block)
+{
+	FreeBlock *freeBlock = new (block) FreeBlock; // Block as list element
+
+	freeBlock->next = freeList;
+	freeList = freeBlock;
+	freeCount++;
+}
+
+/**
+ * @brief		Allocates a block
+ *
+ * @param		void
+ * @return		Pointer to an uninitialized block, NULL if the pool is empty
+ *
+ * @details		Takes the first block of the free list in a critical section
+ * 				of a few instructions. Unlike pvPortMalloc() there is no
+ * 				search and no fragmentation, the time is constant. The block
+ * 				is aligned for any type, e.g. for the storage of a Queue or
+ * 				the stack of a Task created with static memory.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void *MemoryPoolBase::allocate(void)
+{
+	void *block; // Allocated block
+
+	taskENTER_CRITICAL();
+	block = allocateInCritical();
+	taskEXIT_CRITICAL();
+
+	return block;
+}
+
+/**
+ * @brief		Allocates a block from ISR
+ *
+ * @param		void
+ * @return		Pointer to an uninitialized block, NULL if the pool is empty
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void *MemoryPoolBase::allocateFromISR(void)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+	void *block; // Allocated block
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	block = allocateInCritical();
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+
+	return block;
+}
+
+/**
+ * @brief		Frees a block
+ *
+ * @param		block			Block of this pool, or NULL
+ * @return		void
+ *
+ * @details		Puts the block back on the free list in constant time. The
+ * 				block may be freed by another task than the one that
+ * 				allocated it. Freeing NULL has no effect.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MemoryPoolBase::free(void *block)
+{
+	if (block == NULL) {
+		return;
+	}
+
+	assert(isFromPool(block) == true);
+
+	taskENTER_CRITICAL();
+	freeInCritical(block);
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Frees a block from ISR
+ *
+ * @param		block			Block of this pool, or NULL
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MemoryPoolBase::freeFromISR(void *block)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+
+	if (block == NULL) {
+		return;
+	}
+
+	assert(isFromPool(block) == true);
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	freeInCritical(block);
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Allocates a block and constructs an object in it
+ *
+ * @param		args			Arguments of the constructor of `T`
+ * @return		Pointer to the object, NULL if the pool is empty
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, typename... Args>
+inline T *MemoryPoolBase::create(Args &&... args)
+{
+	void *block; // Allocated block
+
+	static_assert(alignof(T) <= alignof(std::max_align_t), "T is over aligned for the pool");
+	assert(sizeof(T) <= blockSize);
+
+	block = allocate();
+
+	if (block == NULL) {
+		return NULL;
+	}
+
+	return new (block) T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief		Destroys an object and frees its block
+ *
+ * @param		object			Object created by create(), or NULL
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void MemoryPoolBase::destroy(T *object)
+{
+	if (object == NULL) {
+		return;
+	}
+
+	object->~T();
+	free(object);
+}
+
+/**
+ * @brief		Checks if a block belongs to this pool
+ *
+ * @param		block			Pointer to check
+ * @return		True if it points to the start of a block of this pool
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MemoryPoolBase::isFromPool(const void *block)
+{
+	uintptr_t offset = (uintptr_t) block - (uintptr_t) storage; // Offset into the storage
+
+	return ((uintptr_t) block >= (uintptr_t) storage) && (offset < (blockSize * count)) && ((offset % blockSize) == 0);
+}
+
+/**
+ * @brief		Constructor
+ *
+ * @param		void
+ *
+ * @details		Constructs a pool of `Count` blocks with at least `BlockSize`
+ * 				bytes each. The blocks are a member of the object, so they
+ * 				are in .bss and nothing is allocated from the FreeRTOS heap.
+ * 				The size of each block is rounded up to the alignment of
+ * 				std::max_align_t, see `alignedBlockSize`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t BlockSize, size_t Count>
+inline MemoryPool<BlockSize, Count>::MemoryPool(void): MemoryPoolBase(blocks, alignedBlockSize, Count)
+{
+	initialize();
+}
+
+/**
+ * @brief		Allocates memory for a container
+ *
+ * @param		n				Number of objects
+ * @return		Pointer to a block for the objects
+ *
+ * @details		Takes one block of the pool, so it suits node based
+ * 				containers like std::list, std::map or std::set, which
+ * 				allocate one node at a time. All the nodes of the container
+ * 				must fit into one block.
+ * @warning		Asserts if the objects don't fit into a block or if the pool
+ * 				is empty, because a standard allocator must not return NULL.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline T *PoolAllocator<T>::allocate(size_t n)
+{
+	void *block; // Allocated block
+
+	assert((n * sizeof(T)) <= pool->getBlockSize());
+
+	block = pool->allocate();
+
+	assert(block != NULL);
+
+	return static_cast<T *>(block);
+}
+
+/**
+ * @brief		Frees memory of a container
+ *
+ * @param		p				Pointer returned by allocate()
+ * @param		n				Number of objects
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void PoolAllocator<T>::deallocate(T *p, size_t n)
+{
+	(void) n;
+
+	pool->free(p);
+}
+
+/**
+ * @brief		Move assignment of the pointer
+ *
+ * @param		other			Pointer to take the object from
+ * @return		Reference to this pointer
+ *
+ * @details		Destroys the current object, if any, and takes over the
+ * 				object of the other pointer.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline PoolPointer<T> &PoolPointer<T>::operator=(PoolPointer &&other)
+{
+	if (this != &other) {
+		release();
+		pool = other.pool;
+		object = other.detach();
+	}
+
+	return *this;
+}
+
+/**
+ * @brief		Destroys the object and frees its block
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		The pointer is empty afterwards. Also called by the
+ * 				destructor.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void PoolPointer<T>::release(void)
+{
+	if (object != NULL) {
+		pool->destroy(object);
+		object = NULL;
+	}
+}
+
+/**
+ * @brief		Destroys the object and frees its block from ISR
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		The destructor of `T` runs in the ISR, so it must be short.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline void PoolPointer<T>::releaseFromISR(void)
+{
+	if (object != NULL) {
+		object->~T();
+		pool->freeFromISR(object);
+		object = NULL;
+	}
+}
+
+/**
+ * @brief		Gives up the ownership of the object
+ *
+ * @param		void
+ * @return		Pointer to the object, the pointer is empty afterwards
+ *
+ * @details		Used to pass the object through a `Queue<T *>` without
+ * 				copying it, e.g.
+ * 				`queue.sendToBack(message.detach());` on the producer side and
+ * 				`PoolPointer<Message> message(pool, queue.receive());` on the
+ * 				consumer side, which frees the block when it's done. This is
+ * 				the zero copy mode of Queue with blocks of any size from a
+ * 				shared pool, unlike ZeroCopyQueue which owns its blocks.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline T *PoolPointer<T>::detach(void)
+{
+	T *ret = object; // Temporary return value
+
+	object = NULL;
+
+	return ret;
+}
+
+/****************************************************************************/
+/* End Header : Memory Pool Class											*/
+/****************************************************************************/
+#endif /* MEMORYPOOL_HPP_ */
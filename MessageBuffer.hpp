@@ -0,0 +1,509 @@
+#ifndef MESSAGEBUFFER_HPP_
+#define MESSAGEBUFFER_HPP_
+/****************************************************************************/
+/*  Header    : Message Buffer Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : MessageBuffer.hpp											*/
+/*                                                                          */
+/*  @brief	  : FreeRTOS-Message-Buffer Wrapper class						*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#if (__cplusplus >= 202002L)
+#include <span>
+#endif
+
+#include <FreeRTOS.h>
+#include <message_buffer.h>
+
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class MessageBuffer : public FreeRTOS
+{
+protected:
+	MessageBufferHandle_t	handle;
+	const size_t			size;
+
+	TickType_t				defaultMaxTicksToWait = portMAX_DELAY;
+	TickType_t				defaultMinTicksToWait = 0;
+
+public:
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	MessageBuffer(size_t bufferSize);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	MessageBuffer(size_t bufferSize, uint8_t *storageBuffer, StaticMessageBuffer_t *messageBuffer);
+#endif
+
+	~MessageBuffer(void);
+
+	bool send(const void *message, size_t length, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool send(const void *message, size_t length, const std::chrono::duration<Rep, Period> timeToWait)	{return send(message, length, convertToTicks(timeToWait));};
+	bool send(const void *message, size_t length);
+
+	bool sendFromISR(const void *message, size_t length, BaseType_t *higherPriorityTaskWoken);
+	bool sendFromISR(const void *message, size_t length);
+
+	size_t receive(void *buffer, size_t length, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	size_t receive(void *buffer, size_t length, const std::chrono::duration<Rep, Period> timeToWait)	{return receive(buffer, length, convertToTicks(timeToWait));};
+	size_t receive(void *buffer, size_t length);
+
+	size_t receiveFromISR(void *buffer, size_t length, BaseType_t *higherPriorityTaskWoken);
+	size_t receiveFromISR(void *buffer, size_t length);
+
+#if (__cplusplus >= 202002L)
+	bool send(std::span<const uint8_t> message, TickType_t ticksToWait)	{return send(message.data(), message.size(), ticksToWait);};
+	template <typename Rep, typename Period>
+	bool send(std::span<const uint8_t> message, const std::chrono::duration<Rep, Period> timeToWait)	{return send(message.data(), message.size(), convertToTicks(timeToWait));};
+	bool send(std::span<const uint8_t> message)								{return send(message.data(), message.size());};
+
+	bool sendFromISR(std::span<const uint8_t> message, BaseType_t *higherPriorityTaskWoken)	{return sendFromISR(message.data(), message.size(), higherPriorityTaskWoken);};
+	bool sendFromISR(std::span<const uint8_t> message)						{return sendFromISR(message.data(), message.size());};
+
+	size_t receive(std::span<uint8_t> buffer, TickType_t ticksToWait)		{return receive(buffer.data(), buffer.size(), ticksToWait);};
+	template <typename Rep, typename Period>
+	size_t receive(std::span<uint8_t> buffer, const std::chrono::duration<Rep, Period> timeToWait)	{return receive(buffer.data(), buffer.size(), convertToTicks(timeToWait));};
+	size_t receive(std::span<uint8_t> buffer)								{return receive(buffer.data(), buffer.size());};
+
+	size_t receiveFromISR(std::span<uint8_t> buffer, BaseType_t *higherPriorityTaskWoken)	{return receiveFromISR(buffer.data(), buffer.size(), higherPriorityTaskWoken);};
+	size_t receiveFromISR(std::span<uint8_t> buffer)						{return receiveFromISR(buffer.data(), buffer.size());};
+#endif
+
+	bool reset(void);
+
+	size_t getSize(void)													{return size;};
+
+	size_t nextLength(void);
+
+	size_t spacesAvailable(void);
+
+	bool isEmpty(void);
+
+	bool isFull(void);
+
+	void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
+
+	void setDefaultMinTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMinTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMinTicksToWait(convertToTicks(newTimeToWait));};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <size_t Size>
+class MessageBufferStatic : public MessageBuffer
+{
+	static_assert(Size > sizeof(size_t), "Size must be larger than the length field of a message");
+
+protected:
+	uint8_t					storageBuffer[Size + 1];
+	StaticMessageBuffer_t	messageBuffer;
+
+public:
+	MessageBufferStatic(void);
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor
+ *
+ * @param		bufferSize		Total number of bytes the message buffer can hold
+ *
+ * @details		Constructs a new message buffer object with the FreeRTOS API
+ * 				function xMessageBufferCreate(). Every message needs
+ * 				`sizeof(size_t)` bytes for its length in addition.
+ * @see			https://www.freertos.org/xMessageBufferCreate.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline MessageBuffer::MessageBuffer(size_t bufferSize): size(bufferSize)
+{
+	handle = xMessageBufferCreate(size);
+
+	assert(handle != NULL);
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		bufferSize		Total number of bytes the message buffer can hold
+ * @param		storageBuffer	Array of at least `bufferSize + 1` bytes
+ * @param		messageBuffer	Used to hold the message buffer's data structure
+ *
+ * @details		Constructs a new message buffer object with the FreeRTOS API
+ * 				function xMessageBufferCreateStatic(). No memory is allocated
+ * 				from the FreeRTOS heap. Unlike the dynamic creation FreeRTOS
+ * 				doesn't add the byte to tell a full from an empty buffer, so
+ * 				`bufferSize + 1` is passed and `bufferSize` bytes are usable.
+ * @see			https://www.freertos.org/xMessageBufferCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline MessageBuffer::MessageBuffer(size_t bufferSize, uint8_t *storageBuffer, StaticMessageBuffer_t *messageBuffer): size(bufferSize)
+{
+	handle = xMessageBufferCreateStatic(size + 1, storageBuffer, messageBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor static message buffer
+ *
+ * @param		void
+ *
+ * @details		Constructs a new message buffer object of `Size` bytes, the
+ * 				storage and the message buffer structure are members of the
+ * 				object. Unlike a Queue, only the bytes of every message plus
+ * 				its length are stored, not the worst case size.
+ * @see			https://www.freertos.org/xMessageBufferCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Size>
+inline MessageBufferStatic<Size>::MessageBufferStatic(void): MessageBuffer(Size, storageBuffer, &messageBuffer)
+{
+};
+#endif
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Deletes the message buffer with the FreeRTOS API function
+ * 				vMessageBufferDelete().
+ * @see			https://www.freertos.org/vMessageBufferDelete.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline MessageBuffer::~MessageBuffer(void)
+{
+	vMessageBufferDelete(handle);
+};
+
+/**
+ * @brief		Sends a message
+ *
+ * @param		message			Pointer to the message to send
+ * @param		length			Length of the message in bytes
+ * @param		ticksToWait		Ticks to wait for enough space
+ * @return		True if the whole message was written, false if the time expired
+ *
+ * @details		Copies the message with the FreeRTOS API function
+ * 				xMessageBufferSend(). A message is written completely or not
+ * 				at all. A message buffer expects exactly one writer and one
+ * 				reader, multiple writers must use a mutex.
+ * @see			https://www.freertos.org/xMessageBufferSend.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::send(const void *message, size_t length, TickType_t ticksToWait)
+{
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, streamBufferSend);
+	ret = (xMessageBufferSend(handle, message, length, ticksToWait) == length) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, streamBufferSend, ret);
+
+	return ret;
+}
+
+/**
+ * @brief		Sends a message with default ticks
+ *
+ * @param		message			Pointer to the message to send
+ * @param		length			Length of the message in bytes
+ * @return		True if the whole message was written, false otherwise
+ *
+ * @details		Sets the ticksToWait to defaultMinTicksToWait. By default this
+ * 				is 0.
+ * @see			https://www.freertos.org/xMessageBufferSend.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::send(const void *message, size_t length)
+{
+	return MessageBuffer::send(message, length, defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Sends a message from ISR
+ *
+ * @param		message						Pointer to the message to send
+ * @param		length						Length of the message in bytes
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if the whole message was written, false otherwise
+ *
+ * @details		If the message unblocks a task with a higher priority than the
+ * 				interrupted one, `higherPriorityTaskWoken` is set to pdTRUE and
+ * 				a context switch should be requested before the ISR exits,
+ * 				e.g. with an `IsrContext` object.
+ * @see			https://www.freertos.org/xMessageBufferSendFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::sendFromISR(const void *message, size_t length, BaseType_t *higherPriorityTaskWoken)
+{
+	return (xMessageBufferSendFromISR(handle, message, length, higherPriorityTaskWoken) == length) ? true : false;
+}
+
+/**
+ * @brief		Sends a message from ISR
+ *
+ * @param		message			Pointer to the message to send
+ * @param		length			Length of the message in bytes
+ * @return		True if the whole message was written, false otherwise
+ *
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xMessageBufferSendFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::sendFromISR(const void *message, size_t length)
+{
+	return MessageBuffer::sendFromISR(message, length, NULL);
+}
+
+/**
+ * @brief		Receives a message
+ *
+ * @param		buffer			Buffer for the received message
+ * @param		length			Size of the buffer in bytes
+ * @param		ticksToWait		Ticks to wait for a message
+ * @return		Length of the received message, 0 if the time expired
+ *
+ * @details		Copies the next message with the FreeRTOS API function
+ * 				xMessageBufferReceive().
+ * @warning		If the next message is larger than `length`, 0 is returned
+ * 				and the message stays in the buffer, check with nextLength().
+ * @see			https://www.freertos.org/xMessageBufferReceive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::receive(void *buffer, size_t length, TickType_t ticksToWait)
+{
+	size_t ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, streamBufferReceive);
+	ret = xMessageBufferReceive(handle, buffer, length, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, streamBufferReceive, (ret != 0));
+
+	return ret;
+}
+
+/**
+ * @brief		Receives a message with default ticks
+ *
+ * @param		buffer			Buffer for the received message
+ * @param		length			Size of the buffer in bytes
+ * @return		Length of the received message, 0 if the time expired
+ *
+ * @details		Sets the ticksToWait to defaultMaxTicksToWait. By default this
+ * 				is portMAX_DELAY.
+ * @see			https://www.freertos.org/xMessageBufferReceive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::receive(void *buffer, size_t length)
+{
+	return MessageBuffer::receive(buffer, length, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives a message from ISR
+ *
+ * @param		buffer						Buffer for the received message
+ * @param		length						Size of the buffer in bytes
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Length of the received message, 0 if there is none
+ *
+ * @details		If reading makes space for a blocked writer with a higher
+ * 				priority than the interrupted task, `higherPriorityTaskWoken`
+ * 				is set to pdTRUE.
+ * @see			https://www.freertos.org/xMessageBufferReceiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::receiveFromISR(void *buffer, size_t length, BaseType_t *higherPriorityTaskWoken)
+{
+	return xMessageBufferReceiveFromISR(handle, buffer, length, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Receives a message from ISR
+ *
+ * @param		buffer			Buffer for the received message
+ * @param		length			Size of the buffer in bytes
+ * @return		Length of the received message, 0 if there is none
+ *
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xMessageBufferReceiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::receiveFromISR(void *buffer, size_t length)
+{
+	return MessageBuffer::receiveFromISR(buffer, length, NULL);
+}
+
+/**
+ * @brief		Resets the message buffer to empty
+ *
+ * @param		void
+ * @return		True if it was successful, false if a task is blocked on it
+ *
+ * @see			https://www.freertos.org/xMessageBufferReset.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::reset(void)
+{
+	return (xMessageBufferReset(handle) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Gets the length of the next message
+ *
+ * @param		void
+ * @return		Length of the next message in bytes, 0 if the buffer is empty
+ *
+ * @see			https://www.freertos.org/xMessageBufferNextLengthBytes.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::nextLength(void)
+{
+	return xMessageBufferNextLengthBytes(handle);
+}
+
+/**
+ * @brief		Gets the free space of the message buffer
+ *
+ * @param		void
+ * @return		Number of free bytes, the length field of the next message
+ * 				included
+ *
+ * @see			https://www.freertos.org/xMessageBufferSpacesAvailable.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t MessageBuffer::spacesAvailable(void)
+{
+	return xMessageBufferSpacesAvailable(handle);
+}
+
+/**
+ * @brief		Checks if the message buffer is empty
+ *
+ * @param		void
+ * @return		True if it's empty, false otherwise
+ *
+ * @see			https://www.freertos.org/xMessageBufferIsEmpty.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::isEmpty(void)
+{
+	return (xMessageBufferIsEmpty(handle) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Checks if the message buffer is full
+ *
+ * @param		void
+ * @return		True if not even a message of one byte fits, false otherwise
+ *
+ * @see			https://www.freertos.org/xMessageBufferIsFull.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool MessageBuffer::isFull(void)
+{
+	return (xMessageBufferIsFull(handle) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Sets the default maximum ticks to wait
+ *
+ * @param		newTicksToWait	Ticks to wait of receive() without a time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MessageBuffer::setDefaultMaxTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMaxTicksToWait = newTicksToWait;
+}
+
+/**
+ * @brief		Sets the default minimum ticks to wait
+ *
+ * @param		newTicksToWait	Ticks to wait of send() without a time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void MessageBuffer::setDefaultMinTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMinTicksToWait = newTicksToWait;
+}
+
+/****************************************************************************/
+/* End Header : Message Buffer Class										*/
+/****************************************************************************/
+#endif /* MESSAGEBUFFER_HPP_ */
@@ -13,7 +13,11 @@
 /*  @date	  : 21.04.2023  NZ	Created                              		*/
 /*                                                                          */
 /*	@remark	  : Last Modifications:											*/
-/* 				- none														*/
+/*				- 14.10.2026	NZ	Mod: Real mutex with priority			*/
+/*									inheritance instead of a binary			*/
+/*									semaphore, add MutexStatic class		*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
 /*																			*/
 /*  @todo	  :	- Test the whole class extensively							*/
 /*																			*/
@@ -22,8 +26,11 @@
 /****************************************************************************/
 
 /* imports */
+#include <FreeRTOS.h>
 #include <semphr.h>
 
+#include "Semaphore.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -33,9 +40,70 @@
 /* Class definition            */
 class Mutex : public Semaphore
 {
+protected:
+	Mutex(SemaphoreHandle_t mutexHandle): Semaphore(mutexHandle, 1) {};
+
+public:
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	Mutex(void);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	Mutex(StaticSemaphore_t *mutexBuffer);
+#endif
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+class MutexStatic : public Mutex
+{
+protected:
+	StaticSemaphore_t		mutexBuffer;
+
 public:
-	Mutex(void): Semaphore() {};
+	MutexStatic(void): Mutex(&mutexBuffer) {};
+};
+#endif
 
-	~Mutex(void);
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor
+ *
+ * @param		void
+ *
+ * @details		Constructs a new mutex object with the FreeRTOS API function
+ * 				xSemaphoreCreateMutex(). Unlike a binary semaphore the mutex
+ * 				includes a priority inheritance mechanism: a low priority task
+ * 				holding the mutex inherits the priority of a higher priority
+ * 				task that blocks on it. The mutex is available after creation.
+ * @warning		A mutex must not be used from an interrupt service routine.
+ * @see			https://www.freertos.org/CreateMutex.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Mutex::Mutex(void): Semaphore(xSemaphoreCreateMutex(), 1)
+{
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		mutexBuffer		Used to hold the mutex's data structure
+ *
+ * @details		Constructs a new mutex object with the FreeRTOS API function
+ * 				xSemaphoreCreateMutexStatic(). No memory is allocated from the
+ * 				FreeRTOS heap. The mutex is available after creation.
+ * @warning		A mutex must not be used from an interrupt service routine.
+ * @see			https://www.freertos.org/xSemaphoreCreateMutexStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Mutex::Mutex(StaticSemaphore_t *mutexBuffer): Semaphore(xSemaphoreCreateMutexStatic(mutexBuffer), 1)
+{
 };
+#endif
 #endif /* MUTEX_HPP_ */
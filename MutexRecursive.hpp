@@ -13,7 +13,13 @@
 /*  @date	  : 21.04.2023  NZ	Created                              		*/
 /*                                                                          */
 /*	@remark	  : Last Modifications:											*/
-/* 				- none														*/
+/*				- 14.10.2026	NZ	Mod: Real recursive mutex instead of a	*/
+/*									binary semaphore, add take() and give()	*/
+/*									and the MutexRecursiveStatic class		*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Add: Optional trace of the blocking calls*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
 /*																			*/
 /*  @todo	  :	- Test the whole class extensively							*/
 /*																			*/
@@ -22,8 +28,14 @@
 /****************************************************************************/
 
 /* imports */
+#include <chrono>
+
+#include <FreeRTOS.h>
 #include <semphr.h>
 
+#include "Mutex.hpp"
+#include "Trace.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -34,16 +46,82 @@
 class MutexRecursive : public Mutex
 {
 public:
-	MutexRecursive(void): Mutex() {};
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	MutexRecursive(void);
+#endif
 
-	~MutexRecursive(void);
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	MutexRecursive(StaticSemaphore_t *mutexBuffer);
+#endif
 
 	bool takeRecursive(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool takeRecursive(const std::chrono::duration<Rep, Period> timeToWait)					{return takeRecursive(convertToTicks(timeToWait));};
 	bool takeRecursive(void);
 
 	bool giveRecursive(void);
+
+	bool take(TickType_t ticksToWait)										{return takeRecursive(ticksToWait);};
+	template <typename Rep, typename Period>
+	bool take(const std::chrono::duration<Rep, Period> timeToWait)							{return takeRecursive(convertToTicks(timeToWait));};
+	bool take(void)															{return takeRecursive();};
+
+	bool give(void)															{return giveRecursive();};
 };
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+class MutexRecursiveStatic : public MutexRecursive
+{
+protected:
+	StaticSemaphore_t		mutexBuffer;
+
+public:
+	MutexRecursiveStatic(void): MutexRecursive(&mutexBuffer) {};
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor
+ *
+ * @param		void
+ *
+ * @details		Constructs a new recursive mutex object with the FreeRTOS API
+ * 				function xSemaphoreCreateRecursiveMutex(). The mutex can be
+ * 				taken repeatedly by the owner and is only available again when
+ * 				the owner has given it back as many times as it was taken.
+ * 				The methods take() and give() are mapped to their recursive
+ * 				counterparts, so the mutex can be used like a `Mutex`.
+ * @see			https://www.freertos.org/xSemaphoreCreateRecursiveMutex.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline MutexRecursive::MutexRecursive(void): Mutex(xSemaphoreCreateRecursiveMutex())
+{
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		mutexBuffer		Used to hold the mutex's data structure
+ *
+ * @details		Constructs a new recursive mutex object with the FreeRTOS API
+ * 				function xSemaphoreCreateRecursiveMutexStatic(). No memory is
+ * 				allocated from the FreeRTOS heap.
+ * @see			https://www.freertos.org/xSemaphoreCreateRecursiveMutexStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline MutexRecursive::MutexRecursive(StaticSemaphore_t *mutexBuffer): Mutex(xSemaphoreCreateRecursiveMutexStatic(mutexBuffer))
+{
+};
+#endif
+
 /**
  * @brief		Obtain a recursive mutex
  *
@@ -57,10 +135,19 @@ public:
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool MutexRecursive::takeRecursive(TickType_t ticksToWait)
 {
-	return (xSemaphoreTakeRecursive(handle, ticksToWait) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, mutexTakeRecursive);
+	ret = (xSemaphoreTakeRecursive(handle, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, mutexTakeRecursive, ret);
+
+	return ret;
 }
 
 /**
@@ -96,9 +183,18 @@ inline bool MutexRecursive::takeRecursive(void)
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool MutexRecursive::giveRecursive(void)
 {
-	return (xSemaphoreGiveRecursive(handle) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, mutexGiveRecursive);
+	ret = (xSemaphoreGiveRecursive(handle) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, mutexGiveRecursive, ret);
+
+	return ret;
 }
 #endif /* MUTEXRECURSIVE_HPP_ */
@@ -0,0 +1,215 @@
+#ifndef PERIODICTASK_HPP_
+#define PERIODICTASK_HPP_
+/****************************************************************************/
+/*  Header    : Periodic Task Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : PeriodicTask.hpp											*/
+/*                                                                          */
+/*  @brief	  : CRTP task with a fixed period, overrun and execution time	*/
+/*				statistics													*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+#include "TaskBase.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+class PeriodicTask : public TaskBase<PeriodicTask<Derived, StackDepth>, StackDepth>
+{
+	friend class TaskBase<PeriodicTask<Derived, StackDepth>, StackDepth>;
+
+public:
+	enum class OverrunPolicy
+	{
+		catchUp,
+		skip
+	};
+
+protected:
+	TickType_t						period;
+	OverrunPolicy					overrunPolicy;
+
+	uint32_t						cycleCount = 0;
+	uint32_t						overrunCount = 0;
+	uint32_t						skippedCount = 0;
+	TickType_t						worstCaseExecutionTime = 0;
+	TickType_t						worstCaseLateness = 0;
+
+	void run(void);
+
+	void onOverrun(TickType_t lateness)										{(void) lateness;};
+
+public:
+	PeriodicTask(std::string_view taskName, UBaseType_t taskPriority, TickType_t taskPeriod, OverrunPolicy policy = OverrunPolicy::catchUp);
+	template <typename Rep, typename Period>
+	PeriodicTask(std::string_view taskName, UBaseType_t taskPriority, const std::chrono::duration<Rep, Period> taskPeriod, OverrunPolicy policy = OverrunPolicy::catchUp)
+		: PeriodicTask(taskName, taskPriority, FreeRTOS::convertToTicks(taskPeriod), policy) {};
+
+	TickType_t getPeriod(void)												{return period;};
+	void setPeriod(TickType_t newPeriod)									{period = newPeriod;};
+
+	OverrunPolicy getOverrunPolicy(void)									{return overrunPolicy;};
+	void setOverrunPolicy(OverrunPolicy newPolicy)							{overrunPolicy = newPolicy;};
+
+	uint32_t getCycleCount(void)											{return cycleCount;};
+	uint32_t getOverrunCount(void)											{return overrunCount;};
+	uint32_t getSkippedCount(void)											{return skippedCount;};
+	TickType_t getWorstCaseExecutionTime(void)								{return worstCaseExecutionTime;};
+	TickType_t getWorstCaseLateness(void)									{return worstCaseLateness;};
+
+	void resetStatistics(void);
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
+ * @param		taskPeriod		Period of the task in ticks
+ * @param		policy			What happens with cycles missed by an overrun
+ *
+ * @details		Prepares a static task that calls `Derived::cycle()` once every
+ * 				`taskPeriod` ticks, timed with xTaskDelayUntil(). The wake
+ * 				time is seeded by the task itself when it starts, so the first
+ * 				cycle runs immediately and all later ones at a fixed phase.
+ * 				`Derived::cycle()` has to be public or `PeriodicTask` a friend.
+ * 				`Derived` may hide onOverrun(TickType_t lateness) to react to a
+ * 				missed period.
+ * 				Like TaskBase the task is only created by start(), once
+ * 				`Derived` is constructed, and `Derived` has to call stop()
+ * 				before its members are destroyed.
+ * @see			https://www.freertos.org/xtaskdelayuntil.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Task is created in start()
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline PeriodicTask<Derived, StackDepth>::PeriodicTask(	std::string_view taskName,
+														UBaseType_t taskPriority,
+														TickType_t taskPeriod,
+														OverrunPolicy policy)
+														:	TaskBase<PeriodicTask<Derived, StackDepth>, StackDepth>(taskName, taskPriority),
+															period(taskPeriod),
+															overrunPolicy(policy)
+{
+}
+
+/**
+ * @brief		Periodic loop of the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Runs `Derived::cycle()` and measures its execution time in
+ * 				ticks. The lateness is the time between the planned wake time
+ * 				and the start of the cycle, i.e. the release jitter. If the
+ * 				cycle took longer than the period, xTaskDelayUntil() returns
+ * 				without delay and the overrun is counted. With
+ * 				`OverrunPolicy::catchUp` the missed cycles run back to back
+ * 				until the task is in phase again. With `OverrunPolicy::skip`
+ * 				the missed cycles are dropped and the task continues with the
+ * 				next wake time in phase.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline void PeriodicTask<Derived, StackDepth>::run(void)
+{
+	TickType_t lastWakeTime = xTaskGetTickCount(); // Planned start of the cycle
+	TickType_t startTime; // Real start of the cycle
+	TickType_t executionTime; // Ticks used by the cycle
+	TickType_t lateness; // Ticks the wake time was missed
+	TickType_t missedCycles; // Complete periods missed by an overrun
+
+	for (;;) {
+		startTime = xTaskGetTickCount();
+
+		if ((TickType_t) (startTime - lastWakeTime) > worstCaseLateness) {
+			worstCaseLateness = startTime - lastWakeTime;
+		}
+
+		static_cast<Derived *>(this)->cycle();
+
+		executionTime = xTaskGetTickCount() - startTime;
+		cycleCount++;
+
+		if (executionTime > worstCaseExecutionTime) {
+			worstCaseExecutionTime = executionTime;
+		}
+
+		if (xTaskDelayUntil(&lastWakeTime, period) == pdFALSE) {
+			lateness = xTaskGetTickCount() - lastWakeTime;
+			overrunCount++;
+
+			static_cast<Derived *>(this)->onOverrun(lateness);
+
+			if ((overrunPolicy == OverrunPolicy::skip) && (period != 0)) {
+				missedCycles = lateness / period;
+				lastWakeTime += missedCycles * period;
+				skippedCount += missedCycles;
+			}
+		}
+	}
+}
+
+/**
+ * @brief		Resets the statistics
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Sets the cycle, overrun and skipped counters and the worst
+ * 				case execution time and lateness back to zero, e.g. after the
+ * 				start up phase of the system.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline void PeriodicTask<Derived, StackDepth>::resetStatistics(void)
+{
+	taskENTER_CRITICAL();
+	cycleCount = 0;
+	overrunCount = 0;
+	skippedCount = 0;
+	worstCaseExecutionTime = 0;
+	worstCaseLateness = 0;
+	taskEXIT_CRITICAL();
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Periodic Task Class											*/
+/****************************************************************************/
+#endif /* PERIODICTASK_HPP_ */
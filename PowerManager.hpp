@@ -0,0 +1,349 @@
+#ifndef POWERMANAGER_HPP_
+#define POWERMANAGER_HPP_
+/****************************************************************************/
+/*  Header    : Power Manager Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : PowerManager.hpp											*/
+/*                                                                          */
+/*  @brief	  : Tickless idle, sleeps in the deepest mode that meets the	*/
+/*				wakeup latency constraints of all tasks and timers			*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- 14.10.2026	NZ	Fix: Slept ticks are limited to the		*/
+/*									expected idle time						*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configUSE_TICKLESS_IDLE != 0)
+/* Class definition            */
+template <typename Hardware>
+class PowerManager : public FreeRTOS
+{
+	static_assert(Hardware::modeCount >= 1, "Hardware needs at least one sleep mode");
+
+public:
+	class Constraint
+	{
+	protected:
+		size_t							limit = Hardware::modeCount;	///< First mode that is not allowed
+
+	public:
+		Constraint(void) {};
+		template <typename Rep, typename Period>
+		Constraint(const std::chrono::duration<Rep, Period> maxLatency)		{set(maxLatency);};
+
+		~Constraint(void)													{clear();};
+
+		Constraint(const Constraint &) = delete;
+		Constraint &operator=(const Constraint &) = delete;
+
+		void set(std::chrono::microseconds maxLatency);
+		template <typename Rep, typename Period>
+		void set(const std::chrono::duration<Rep, Period> maxLatency)		{set(std::chrono::ceil<std::chrono::microseconds>(maxLatency));};
+
+		void clear(void);
+
+		bool isActive(void)													{return (limit != Hardware::modeCount) ? true : false;};
+	};
+
+protected:
+	inline static uint32_t			limitCount[Hardware::modeCount] = {};
+	inline static uint32_t			sleepCount[Hardware::modeCount] = {};
+	inline static uint64_t			sleptTicks = 0;
+
+	void static maskInterrupts(void);
+	void static unmaskInterrupts(void);
+
+public:
+	size_t static getDeepestMode(void);
+
+	size_t static selectMode(TickType_t expectedIdleTime);
+
+	void static suppressTicksAndSleep(TickType_t expectedIdleTime);
+
+	uint32_t static getSleepCount(size_t mode);
+
+	uint64_t static getSleptTicks(void)										{return sleptTicks;};
+};
+
+/**
+ * @brief		Sets the maximum wakeup latency
+ *
+ * @param		maxLatency		Longest time the owner accepts until the system is awake
+ * @return		void
+ *
+ * @details		Forbids all sleep modes whose wakeup latency of the `Hardware`
+ * 				is longer than `maxLatency`, e.g. a task that must answer an
+ * 				interrupt within 200 µs holds
+ * 				`PowerManager<Lptim>::Constraint latency(200us);` while it
+ * 				waits for it. Mode `0` is always allowed. Replaces the last
+ * 				value of the constraint, set and clear are done in a critical
+ * 				section.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline void PowerManager<Hardware>::Constraint::set(std::chrono::microseconds maxLatency)
+{
+	size_t newLimit = Hardware::modeCount; // First mode not allowed
+
+	for (size_t mode = 1; mode < Hardware::modeCount; mode++) {
+		if (Hardware::wakeupLatency[mode] > maxLatency) {
+			newLimit = mode;
+			break;
+		}
+	}
+
+	taskENTER_CRITICAL();
+
+	if (limit != Hardware::modeCount) {
+		limitCount[limit]--;
+	}
+
+	if (newLimit != Hardware::modeCount) {
+		limitCount[newLimit]++;
+	}
+
+	limit = newLimit;
+
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Removes the constraint
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Allows all sleep modes again, as far as no other constraint
+ * 				forbids them. Called by the destructor.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline void PowerManager<Hardware>::Constraint::clear(void)
+{
+	taskENTER_CRITICAL();
+
+	if (limit != Hardware::modeCount) {
+		limitCount[limit]--;
+	}
+
+	limit = Hardware::modeCount;
+
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Masks all interrupts for the sleep
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		On Cortex-M3/M4/M7/M33 PRIMASK is set, so a pending interrupt
+ * 				still ends the WFI but is only taken after the tick count was
+ * 				corrected. On other ports taskDISABLE_INTERRUPTS() is used.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline void PowerManager<Hardware>::maskInterrupts(void)
+{
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+	__asm volatile ("cpsid i" ::: "memory");
+	__asm volatile ("dsb" ::: "memory");
+	__asm volatile ("isb" ::: "memory");
+#else
+	taskDISABLE_INTERRUPTS();
+#endif
+}
+
+/**
+ * @brief		Unmasks the interrupts after the sleep
+ *
+ * @param		void
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline void PowerManager<Hardware>::unmaskInterrupts(void)
+{
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+	__asm volatile ("cpsie i" ::: "memory");
+	__asm volatile ("isb" ::: "memory");
+#else
+	taskENABLE_INTERRUPTS();
+#endif
+}
+
+/**
+ * @brief		Gets the deepest mode all constraints allow
+ *
+ * @param		void
+ * @return		Index of the mode, `0` is the lightest
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline size_t PowerManager<Hardware>::getDeepestMode(void)
+{
+	for (size_t mode = 1; mode < Hardware::modeCount; mode++) {
+		if (limitCount[mode] != 0) {
+			return mode - 1;
+		}
+	}
+
+	return Hardware::modeCount - 1;
+}
+
+/**
+ * @brief		Selects the mode of the next sleep
+ *
+ * @param		expectedIdleTime	Ticks until the next task or timer is due
+ * @return		Index of the mode, `0` is the lightest
+ *
+ * @details		Takes the deepest mode allowed by the constraints and goes
+ * 				lighter while its wakeup latency doesn't fit into the expected
+ * 				idle time. So the next deadline of a task or timer is met even
+ * 				without a constraint.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline size_t PowerManager<Hardware>::selectMode(TickType_t expectedIdleTime)
+{
+	size_t mode = getDeepestMode(); // Deepest allowed mode
+	std::chrono::microseconds idleTime((uint64_t) expectedIdleTime * 1000000 / configTICK_RATE_HZ); // Expected idle time
+
+	while ((mode > 0) && (Hardware::wakeupLatency[mode] >= idleTime)) {
+		mode--;
+	}
+
+	return mode;
+}
+
+/**
+ * @brief		Stops the tick and sleeps
+ *
+ * @param		expectedIdleTime	Ticks until the next task or timer is due
+ * @return		void
+ *
+ * @details		Implements portSUPPRESS_TICKS_AND_SLEEP(). The idle task calls
+ * 				it with the scheduler suspended. It masks the interrupts,
+ * 				confirms the sleep with eTaskConfirmSleepModeStatus(), selects
+ * 				the mode and lets `Hardware::sleep(mode, ticks)` stop the tick,
+ * 				program the wakeup timer (e.g. the LPTIM of the STM32G474,
+ * 				which runs in stop mode), sleep and return the ticks that
+ * 				passed. The tick count is then corrected with stepTick().
+ * 				`Hardware` provides:
+ * 				- `static constexpr size_t modeCount`, number of modes, `0`
+ * 				  is the lightest, e.g. sleep, stop 0, stop 1.
+ * 				- `static constexpr std::chrono::microseconds wakeupLatency[modeCount]`
+ * 				- `static constexpr TickType_t maxSuppressedTicks`, longest
+ * 				  sleep of the wakeup timer.
+ * 				- `static TickType_t sleep(size_t mode, TickType_t ticks)`,
+ * 				  called with masked interrupts, returns at most `ticks`.
+ * 				A result above the expected idle time would step the tick
+ * 				count past the next unblock time, which vTaskStepTick()
+ * 				asserts, so it's limited to the expected idle time. The
+ * 				reference policy of the STM32G474 is LptimStm32g474.
+ * 				The hook needs C linkage, e.g. in FreeRTOSConfig.h
+ * 				`#define portSUPPRESS_TICKS_AND_SLEEP(x) vApplicationSleep(x)`
+ * 				and in one source file
+ * 				`extern "C" void vApplicationSleep(TickType_t x) {PowerManager<Lptim>::suppressTicksAndSleep(x);}`.
+ * @see			https://www.freertos.org/low-power-tickless-rtos.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Limits the slept ticks to the
+ * 									expected idle time
+ ****************************************************************************/
+template <typename Hardware>
+inline void PowerManager<Hardware>::suppressTicksAndSleep(TickType_t expectedIdleTime)
+{
+	size_t mode; // Selected sleep mode
+	TickType_t slept; // Ticks passed during the sleep
+
+	if (expectedIdleTime > Hardware::maxSuppressedTicks) {
+		expectedIdleTime = Hardware::maxSuppressedTicks;
+	}
+
+	maskInterrupts();
+
+	if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+		unmaskInterrupts();
+		return;
+	}
+
+	mode = selectMode(expectedIdleTime);
+	slept = Hardware::sleep(mode, expectedIdleTime);
+
+	if (slept > expectedIdleTime) {
+		slept = expectedIdleTime;
+	}
+
+	if (slept != 0) {
+		stepTick(slept);
+	}
+
+	sleepCount[mode]++;
+	sleptTicks += slept;
+
+	unmaskInterrupts();
+}
+
+/**
+ * @brief		Gets the number of sleeps in a mode
+ *
+ * @param		mode		Index of the mode
+ * @return		Number of sleeps since the start
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Hardware>
+inline uint32_t PowerManager<Hardware>::getSleepCount(size_t mode)
+{
+	assert(mode < Hardware::modeCount);
+
+	return sleepCount[mode];
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Power Manager Class											*/
+/****************************************************************************/
+#endif /* POWERMANAGER_HPP_ */
@@ -0,0 +1,227 @@
+#ifndef POWERMANAGERSTM32G474_HPP_
+#define POWERMANAGERSTM32G474_HPP_
+/****************************************************************************/
+/*  Header    : STM32G474 LPTIM Power Policy Class							*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : PowerManagerStm32g474.hpp									*/
+/*                                                                          */
+/*  @brief	  : Reference hardware policy of the PowerManager for the		*/
+/*				STM32G474, the tick is kept by LPTIM1 while SysTick is		*/
+/*				stopped														*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "PowerManager.hpp"
+
+/* Class constant declaration  */
+#ifndef LPTIMSTM32G474_CLOCK_HZ
+#define LPTIMSTM32G474_CLOCK_HZ		32768UL		///< LSE clock of LPTIM1, prescaler 1
+#endif
+
+#define LPTIMSTM32G474_ISR			(*(volatile uint32_t *) 0x40007C00UL)	///< LPTIM1->ISR
+#define LPTIMSTM32G474_ISR_ARRM		(1UL << 1)
+#define LPTIMSTM32G474_ISR_ARROK	(1UL << 4)
+#define LPTIMSTM32G474_ICR			(*(volatile uint32_t *) 0x40007C04UL)	///< LPTIM1->ICR
+#define LPTIMSTM32G474_ICR_ALL		(0x7FUL)
+#define LPTIMSTM32G474_IER			(*(volatile uint32_t *) 0x40007C08UL)	///< LPTIM1->IER
+#define LPTIMSTM32G474_IER_ARRMIE	(1UL << 1)
+#define LPTIMSTM32G474_CFGR			(*(volatile uint32_t *) 0x40007C0CUL)	///< LPTIM1->CFGR
+#define LPTIMSTM32G474_CR			(*(volatile uint32_t *) 0x40007C10UL)	///< LPTIM1->CR
+#define LPTIMSTM32G474_CR_ENABLE	(1UL << 0)
+#define LPTIMSTM32G474_CR_SNGSTRT	(1UL << 1)
+#define LPTIMSTM32G474_ARR			(*(volatile uint32_t *) 0x40007C18UL)	///< LPTIM1->ARR
+#define LPTIMSTM32G474_CNT			(*(volatile uint32_t *) 0x40007C1CUL)	///< LPTIM1->CNT
+#define LPTIMSTM32G474_PWR_CR1		(*(volatile uint32_t *) 0x40007000UL)	///< PWR->CR1
+#define LPTIMSTM32G474_PWR_LPMS		(7UL << 0)
+#define LPTIMSTM32G474_RCC_APB1ENR1	(*(volatile uint32_t *) 0x40021058UL)	///< RCC->APB1ENR1
+#define LPTIMSTM32G474_RCC_LPTIM1EN	(1UL << 31)
+#define LPTIMSTM32G474_RCC_CCIPR	(*(volatile uint32_t *) 0x40021088UL)	///< RCC->CCIPR
+#define LPTIMSTM32G474_RCC_LPTIM1SEL	(3UL << 18)							///< LSE
+#define LPTIMSTM32G474_EXTI_IMR1	(*(volatile uint32_t *) 0x40010400UL)	///< EXTI->IMR1
+#define LPTIMSTM32G474_EXTI_LPTIM1	(1UL << 29)
+#define LPTIMSTM32G474_NVIC_ISER1	(*(volatile uint32_t *) 0xE000E104UL)	///< NVIC->ISER[1]
+#define LPTIMSTM32G474_NVIC_ICPR1	(*(volatile uint32_t *) 0xE000E284UL)	///< NVIC->ICPR[1]
+#define LPTIMSTM32G474_NVIC_LPTIM1	(1UL << (49 - 32))						///< LPTIM1_IRQn
+#define LPTIMSTM32G474_SCB_SCR		(*(volatile uint32_t *) 0xE000ED10UL)	///< SCB->SCR
+#define LPTIMSTM32G474_SCR_SLEEPDEEP	(1UL << 2)
+#define LPTIMSTM32G474_SYST_CSR		(*(volatile uint32_t *) 0xE000E010UL)	///< SysTick->CTRL
+#define LPTIMSTM32G474_SYST_ENABLE	(1UL << 0)
+#define LPTIMSTM32G474_SYST_CVR		(*(volatile uint32_t *) 0xE000E018UL)	///< SysTick->VAL
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configUSE_TICKLESS_IDLE != 0) && defined(__ARM_ARCH_7EM__)
+/* Class definition            */
+template <void (*RestoreClock)(void) = nullptr>
+class LptimStm32g474
+{
+protected:
+	uint32_t static getCount(void);
+
+public:
+	static constexpr size_t						modeCount = 3;	///< Sleep, Stop 0, Stop 1
+	static constexpr std::chrono::microseconds	wakeupLatency[modeCount] = {std::chrono::microseconds(1), std::chrono::microseconds(50), std::chrono::microseconds(60)};
+	static constexpr TickType_t					maxSuppressedTicks = (TickType_t) ((0xFFFFULL * configTICK_RATE_HZ) / LPTIMSTM32G474_CLOCK_HZ);
+
+	void static init(void);
+
+	TickType_t static sleep(size_t mode, TickType_t ticks);
+};
+
+/**
+ * @brief		Initializes LPTIM1 as tick source during the sleep
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Call it once before the scheduler starts, the LSE must already
+ * 				run. LPTIM1 is clocked by the LSE and enabled as wakeup source
+ * 				in the EXTI (line 29) and the NVIC. The LPTIM1 interrupt wakes
+ * 				the WFI while interrupts are masked, sleep() clears it before
+ * 				they are unmasked, so LPTIM1_IRQHandler is never entered. The
+ * 				registers are accessed directly, so CMSIS isn't needed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <void (*RestoreClock)(void)>
+inline void LptimStm32g474<RestoreClock>::init(void)
+{
+	LPTIMSTM32G474_RCC_APB1ENR1 = LPTIMSTM32G474_RCC_APB1ENR1 | LPTIMSTM32G474_RCC_LPTIM1EN;
+	LPTIMSTM32G474_RCC_CCIPR = LPTIMSTM32G474_RCC_CCIPR | LPTIMSTM32G474_RCC_LPTIM1SEL;
+
+	LPTIMSTM32G474_CR = 0;
+	LPTIMSTM32G474_CFGR = 0;
+	LPTIMSTM32G474_IER = LPTIMSTM32G474_IER_ARRMIE;
+
+	LPTIMSTM32G474_EXTI_IMR1 = LPTIMSTM32G474_EXTI_IMR1 | LPTIMSTM32G474_EXTI_LPTIM1;
+	LPTIMSTM32G474_NVIC_ISER1 = LPTIMSTM32G474_NVIC_LPTIM1;
+}
+
+/**
+ * @brief		Gets the counter of LPTIM1
+ *
+ * @param		void
+ * @return		Counts since the start
+ *
+ * @details		The counter runs asynchronously to the APB clock, so it's read
+ * 				until two reads give the same value, as the reference manual
+ * 				requires.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <void (*RestoreClock)(void)>
+inline uint32_t LptimStm32g474<RestoreClock>::getCount(void)
+{
+	uint32_t count; // Last read of the counter
+
+	do {
+		count = LPTIMSTM32G474_CNT;
+	} while (count != LPTIMSTM32G474_CNT);
+
+	return count;
+}
+
+/**
+ * @brief		Sleeps for at most the given number of ticks
+ *
+ * @param		mode			0 = Sleep, 1 = Stop 0, 2 = Stop 1
+ * @param		ticks			Expected idle time in ticks, at most maxSuppressedTicks
+ * @return		Ticks slept, at most `ticks`
+ *
+ * @details		Called by PowerManager<LptimStm32g474<>>::suppressTicksAndSleep()
+ * 				with masked interrupts. SysTick is stopped and LPTIM1 counts
+ * 				the expected idle time once, then the core waits in WFI with
+ * 				SLEEPDEEP and LPMS set for the stop modes. After the wakeup by
+ * 				LPTIM1 or any other interrupt `RestoreClock` (if given) starts
+ * 				the PLL again, as the stop modes return on HSI16, the whole
+ * 				ticks elapsed are read from LPTIM1 and SysTick is restarted.
+ * 				The fraction of a tick of an early wakeup is lost, so the tick
+ * 				count drifts slightly behind with many early wakeups. The
+ * 				wakeup latencies are typical values including a PLL restart,
+ * 				measure them on the board.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <void (*RestoreClock)(void)>
+inline TickType_t LptimStm32g474<RestoreClock>::sleep(size_t mode, TickType_t ticks)
+{
+	uint32_t counts = (uint32_t) (((uint64_t) ticks * LPTIMSTM32G474_CLOCK_HZ) / configTICK_RATE_HZ); // Counts of the idle time
+	TickType_t slept; // Ticks slept
+
+	if (counts < 2) {
+		return 0;
+	}
+
+	LPTIMSTM32G474_SYST_CSR = LPTIMSTM32G474_SYST_CSR & ~LPTIMSTM32G474_SYST_ENABLE;
+
+	LPTIMSTM32G474_CR = LPTIMSTM32G474_CR_ENABLE;
+	LPTIMSTM32G474_ICR = LPTIMSTM32G474_ICR_ALL;
+	LPTIMSTM32G474_ARR = counts;
+	while ((LPTIMSTM32G474_ISR & LPTIMSTM32G474_ISR_ARROK) == 0) {
+	}
+	LPTIMSTM32G474_ICR = LPTIMSTM32G474_ISR_ARROK;
+	LPTIMSTM32G474_CR = LPTIMSTM32G474_CR_ENABLE | LPTIMSTM32G474_CR_SNGSTRT;
+
+	if (mode != 0) {
+		LPTIMSTM32G474_PWR_CR1 = (LPTIMSTM32G474_PWR_CR1 & ~LPTIMSTM32G474_PWR_LPMS) | (uint32_t) (mode - 1);
+		LPTIMSTM32G474_SCB_SCR = LPTIMSTM32G474_SCB_SCR | LPTIMSTM32G474_SCR_SLEEPDEEP;
+	}
+
+	__asm volatile ("dsb" ::: "memory");
+	__asm volatile ("wfi");
+	__asm volatile ("isb");
+
+	if (mode != 0) {
+		LPTIMSTM32G474_SCB_SCR = LPTIMSTM32G474_SCB_SCR & ~LPTIMSTM32G474_SCR_SLEEPDEEP;
+
+		if constexpr (RestoreClock != nullptr) {
+			RestoreClock();
+		}
+	}
+
+	if ((LPTIMSTM32G474_ISR & LPTIMSTM32G474_ISR_ARRM) != 0) {
+		slept = ticks;
+	} else {
+		slept = (TickType_t) (((uint64_t) getCount() * configTICK_RATE_HZ) / LPTIMSTM32G474_CLOCK_HZ);
+	}
+
+	LPTIMSTM32G474_ICR = LPTIMSTM32G474_ICR_ALL;
+	LPTIMSTM32G474_CR = 0;
+	LPTIMSTM32G474_NVIC_ICPR1 = LPTIMSTM32G474_NVIC_LPTIM1;
+
+	LPTIMSTM32G474_SYST_CVR = 0;
+	LPTIMSTM32G474_SYST_CSR = LPTIMSTM32G474_SYST_CSR | LPTIMSTM32G474_SYST_ENABLE;
+
+	return (slept > ticks) ? ticks : slept;
+}
+#endif /* (configUSE_TICKLESS_IDLE != 0) && defined(__ARM_ARCH_7EM__) */
+
+/****************************************************************************/
+/* End Header : STM32G474 LPTIM Power Policy Class							*/
+/****************************************************************************/
+#endif /* POWERMANAGERSTM32G474_HPP_ */
@@ -17,27 +17,48 @@
 /*				- 17.04.2023	NZ	Mod: Modified class, to a template class*/
 /*				- 21.04.2023	NZ	Mod: Combined .cpp and .hpp and made the*/
 /*									methods inline							*/
+/*				- 14.10.2026	NZ	Add: Static allocation, QueueStatic		*/
+/*									class									*/
+/*				- 14.10.2026	NZ	Mod: Name as std::string_view, stored	*/
+/*									in a fixed size buffer					*/
+/*				- 14.10.2026	NZ	Add: FromISR methods with the			*/
+/*									pxHigherPriorityTaskWoken parameter		*/
+/*				- 14.10.2026	NZ	Add: Batch send and receive methods		*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Fix: sendToFront() sends to the front	*/
+/*				- 14.10.2026	NZ	Add: peek(), isFullFromISR() and		*/
+/*									isEmptyFromISR()						*/
+/*				- 14.10.2026	NZ	Add: Non asserting tryReceive(),		*/
+/*									receiveOptional() and receiveInto()		*/
+/*				- 14.10.2026	NZ	Add: Optional trace of the blocking calls*/
+/*				- 14.10.2026	NZ	Add: ItemType alias						*/
+/*				- 14.10.2026	NZ	Fix: receiveFromISR() doesn't assert	*/
+/*									on an empty queue again					*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
+/*				- 14.10.2026	NZ	Add: Hooks for the optional queue		*/
+/*									telemetry								*/
 /*                                                                          */
-/*  @todo	  :	- Add this functions from API								*/
-/*					- xQueueCreateStatic() 									*/
-/*					- xQueueOverwrite() 									*/
-/*					- xQueueOverwriteFromISR()								*/
-/*					- xQueuePeek()		 									*/
-/*					- xQueuePeekFromISR()									*/
-/*					- xQueueIsQueueFullFromISR()							*/
-/*					- xQueueIsQueueEmptyFromISR()							*/
-/*				- Test the whole class extensively							*/
+/*  @todo	  :	- Test the whole class extensively							*/
 /*																			*/
 /****************************************************************************/
 /*																			*/
 /****************************************************************************/
 
 /* imports */
-#include <string>
+#include <chrono>
+#include <new>
+#include <optional>
+#include <string_view>
+#include <type_traits>
 
 #include <FreeRTOS.h>
 #include <queue.h>
 
+#include "FreeRTOS.hpp"
+#include "QueueTelemetry.hpp"
+#include "Trace.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -52,45 +73,136 @@ class Queue : public FreeRTOS
 protected:
 	QueueHandle_t		handle;
 	const UBaseType_t	length;
-	const std::string	name = "";
+	char				name[configMAX_TASK_NAME_LEN] = {};
 
 	TickType_t			defaultMaxTicksToWait = portMAX_DELAY;
 	TickType_t			defaultMinTicksToWait = 0;
 
+#if (configUSE_QUEUE_TELEMETRY == 1)
+	QueueTelemetryBase	*telemetry = NULL;
+#endif
+
 public:
+	using ItemType = T;
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 	Queue(UBaseType_t queueLength);
-	Queue(UBaseType_t queueLength, bool addToRegistry, std::string queueName);
+	Queue(UBaseType_t queueLength, bool addToRegistry, std::string_view queueName);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	Queue(UBaseType_t queueLength, uint8_t *storageBuffer, StaticQueue_t *queueBuffer);
+	Queue(UBaseType_t queueLength, uint8_t *storageBuffer, StaticQueue_t *queueBuffer, bool addToRegistry, std::string_view queueName);
+#endif
 
 	~Queue(void);
 
 	bool reset(void);
 
 	bool sendToBack(const T itemToQueue, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool sendToBack(const T itemToQueue, const std::chrono::duration<Rep, Period> timeToWait)	{return sendToBack(itemToQueue, convertToTicks(timeToWait));};
 	bool sendToBack(const T itemToQueue);
 
+	bool sendToBackFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken);
 	bool sendToBackFromISR(const T itemToQueue);
 
 	bool sendToFront(const T itemToQueue, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool sendToFront(const T itemToQueue, const std::chrono::duration<Rep, Period> timeToWait)	{return sendToFront(itemToQueue, convertToTicks(timeToWait));};
 	bool sendToFront(const T itemToQueue);
 
+	bool sendToFrontFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken);
 	bool sendToFrontFromISR(const T itemToQueue);
 
 	T receive(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	T receive(const std::chrono::duration<Rep, Period> timeToWait)						{return receive(convertToTicks(timeToWait));};
 	T receive(void);
 
+	T receiveFromISR(BaseType_t *higherPriorityTaskWoken);
 	T receiveFromISR(void);
 
+	bool tryReceive(T &item, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool tryReceive(T &item, const std::chrono::duration<Rep, Period> timeToWait)	{return tryReceive(item, convertToTicks(timeToWait));};
+	bool tryReceive(T &item);
+
+	bool tryReceiveFromISR(T &item, BaseType_t *higherPriorityTaskWoken);
+	bool tryReceiveFromISR(T &item);
+
+	std::optional<T> receiveOptional(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	std::optional<T> receiveOptional(const std::chrono::duration<Rep, Period> timeToWait)	{return receiveOptional(convertToTicks(timeToWait));};
+	std::optional<T> receiveOptional(void);
+
+	std::optional<T> receiveOptionalFromISR(BaseType_t *higherPriorityTaskWoken);
+	std::optional<T> receiveOptionalFromISR(void);
+
+	bool receiveInto(T *buffer, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool receiveInto(T *buffer, const std::chrono::duration<Rep, Period> timeToWait)	{return receiveInto(buffer, convertToTicks(timeToWait));};
+	bool receiveInto(T *buffer);
+
+	bool receiveIntoFromISR(T *buffer, BaseType_t *higherPriorityTaskWoken);
+	bool receiveIntoFromISR(T *buffer);
+
+	bool peek(T &item, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool peek(T &item, const std::chrono::duration<Rep, Period> timeToWait)	{return peek(item, convertToTicks(timeToWait));};
+	bool peek(T &item);
+
+	bool peekFromISR(T &item);
+
+	size_t sendBatch(const T *itemsToQueue, size_t numberOfItems, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	size_t sendBatch(const T *itemsToQueue, size_t numberOfItems, const std::chrono::duration<Rep, Period> timeToWait)	{return sendBatch(itemsToQueue, numberOfItems, convertToTicks(timeToWait));};
+	size_t sendBatch(const T *itemsToQueue, size_t numberOfItems);
+
+	size_t sendBatchFromISR(const T *itemsToQueue, size_t numberOfItems, BaseType_t *higherPriorityTaskWoken);
+
+	size_t receiveBatch(T *buffer, size_t maxItems, TickType_t firstTicksToWait);
+	template <typename Rep, typename Period>
+	size_t receiveBatch(T *buffer, size_t maxItems, const std::chrono::duration<Rep, Period> firstTimeToWait)	{return receiveBatch(buffer, maxItems, convertToTicks(firstTimeToWait));};
+	size_t receiveBatch(T *buffer, size_t maxItems);
+
+	size_t receiveBatchFromISR(T *buffer, size_t maxItems, BaseType_t *higherPriorityTaskWoken);
+
 	UBaseType_t messagesWaiting(void);
 
 	UBaseType_t messagesWaitingFromISR(void);
 
 	UBaseType_t spacesAvailable(void);
 
+	bool isFullFromISR(void);
+
+	bool isEmptyFromISR(void);
+
 	void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
 
 	void setDefaultMinTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMinTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMinTicksToWait(convertToTicks(newTimeToWait));};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename T, UBaseType_t Length>
+class QueueStatic : public Queue<T>
+{
+protected:
+	uint8_t				storageBuffer[Length * sizeof(T)];
+	StaticQueue_t		queueBuffer;
+
+public:
+	QueueStatic(void);
+	QueueStatic(bool addToRegistry, std::string_view queueName);
 };
+#endif
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 /**
  * @brief		Constructor
  *
@@ -127,17 +239,114 @@ inline Queue<T>::Queue(UBaseType_t queueLength):length(queueLength)
  * @date		10.04.2023	NZ	Created
  ****************************************************************************/
 template <typename T>
-inline Queue<T>::Queue(UBaseType_t queueLength, bool addToRegistry, std::string queueName):length(queueLength), name(queueName)
+inline Queue<T>::Queue(UBaseType_t queueLength, bool addToRegistry, std::string_view queueName):length(queueLength)
 {
 	handle = xQueueCreate(length, sizeof(T));
 
 	assert(handle != NULL);
 
 	if (addToRegistry == true) {
-		vQueueAddToRegistry(handle, (const char * const) name.c_str());
+		copyName(name, sizeof(name), queueName);
+		vQueueAddToRegistry(handle, name);
+	}
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		queueLength		Length of the queue (max. items in queue)
+ * @param		storageBuffer	Array of at least queueLength * sizeof(T) bytes
+ * @param		queueBuffer		Used to hold the queue's data structure
+ *
+ * @details		Constructs a new queue object with the FreeRTOS API function
+ * 				xQueueCreateStatic(). No memory is allocated from the FreeRTOS
+ * 				heap, the buffers must exist as long as the queue exists.
+ * @see			https://www.freertos.org/xQueueCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline Queue<T>::Queue(UBaseType_t queueLength, uint8_t *storageBuffer, StaticQueue_t *queueBuffer):length(queueLength)
+{
+	handle = xQueueCreateStatic(length, sizeof(T), storageBuffer, queueBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor, with static memory and add to registry
+ *
+ * @param		queueLength		Length of the queue (max. items in queue)
+ * @param		storageBuffer	Array of at least queueLength * sizeof(T) bytes
+ * @param		queueBuffer		Used to hold the queue's data structure
+ * @param		addToRegistry	Set to true the queue is added to the registry
+ * @param		queueName		Name of the queue in the registry
+ *
+ * @details		Constructs a new queue object with the FreeRTOS API function
+ * 				xQueueCreateStatic() and adds it to the registry for easy
+ * 				debugging.
+ * @see			https://www.freertos.org/xQueueCreateStatic.html
+ * @see			https://www.freertos.org/vQueueAddToRegistry.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline Queue<T>::Queue(UBaseType_t queueLength, uint8_t *storageBuffer, StaticQueue_t *queueBuffer, bool addToRegistry, std::string_view queueName):length(queueLength)
+{
+	handle = xQueueCreateStatic(length, sizeof(T), storageBuffer, queueBuffer);
+
+	assert(handle != NULL);
+
+	if (addToRegistry == true) {
+		copyName(name, sizeof(name), queueName);
+		vQueueAddToRegistry(handle, name);
 	}
 };
 
+/**
+ * @brief		Constructor, static queue
+ *
+ * @param		void
+ *
+ * @details		Constructs a new queue object of `Length` items with the
+ * 				FreeRTOS API function xQueueCreateStatic(). The item storage
+ * 				and the queue structure are members of the object, so nothing
+ * 				is allocated at runtime.
+ * @see			https://www.freertos.org/xQueueCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline QueueStatic<T, Length>::QueueStatic(void):Queue<T>(Length, storageBuffer, &queueBuffer)
+{
+};
+
+/**
+ * @brief		Constructor, static queue with add to registry
+ *
+ * @param		addToRegistry	Set to true the queue is added to the registry
+ * @param		queueName		Name of the queue in the registry
+ *
+ * @details		Constructs a new queue object of `Length` items with the
+ * 				FreeRTOS API function xQueueCreateStatic() and adds it to the
+ * 				registry for easy debugging.
+ * @see			https://www.freertos.org/xQueueCreateStatic.html
+ * @see			https://www.freertos.org/vQueueAddToRegistry.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline QueueStatic<T, Length>::QueueStatic(bool addToRegistry, std::string_view queueName):Queue<T>(Length, storageBuffer, &queueBuffer, addToRegistry, queueName)
+{
+};
+#endif
+
 /**
  * @brief		Destructor
  *
@@ -190,11 +399,23 @@ inline bool Queue<T>::reset(void)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
+ * 				- 14.10.2026	NZ	Mod: Counts for the optional queue
+ * 									telemetry
  ****************************************************************************/
 template <typename T>
 inline bool Queue<T>::sendToBack(const T itemToQueue, TickType_t ticksToWait)
 {
-	return (xQueueSendToBack(handle, (void *) &itemToQueue, ticksToWait) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, queueSendToBack);
+	ret = (xQueueSendToBack(handle, (void *) &itemToQueue, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, queueSendToBack, ret);
+	QUEUE_TELEMETRY_SEND((ret == true) ? 1 : 0, (ret == false));
+
+	return ret;
 }
 
 /**
@@ -220,6 +441,36 @@ inline bool Queue<T>::sendToBack(const T itemToQueue)
 	return Queue<T>::sendToBack(itemToQueue, defaultMinTicksToWait);
 }
 
+/**
+ * @brief		Sends item to queue back from an ISR
+ *
+ * @param		itemToQueue					Item to push to back
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Sends an item to the back of the queue from an interrupt
+ * 				service routine, it has no delay because it doesn't block.
+ * 				If sending unblocks a task with a higher priority than the
+ * 				interrupted one, `higherPriorityTaskWoken` is set to pdTRUE
+ * 				and a context switch should be requested before the ISR exits,
+ * 				e.g. with an `IsrContext` object. It is never set to pdFALSE,
+ * 				so one flag can be used for several calls.
+ * @see			https://www.freertos.org/xQueueSendToBackFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::sendToBackFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken)
+{
+	bool ret; // Temporary return value
+
+	ret = (xQueueSendToBackFromISR(handle, (void *) &itemToQueue, higherPriorityTaskWoken) == pdTRUE) ? true : false;
+	QUEUE_TELEMETRY_SEND_FROM_ISR((ret == true) ? 1 : 0, (ret == false));
+
+	return ret;
+}
+
 /**
  * @brief		Sends item to queue back from an ISR
  *
@@ -229,16 +480,20 @@ inline bool Queue<T>::sendToBack(const T itemToQueue)
  * @details		Sends an item to the back of the queue from an interrupt
  * 				service routine, it has no delay because it doesn't block.
  * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
- * 				and is constant set to `NULL`.
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
  * @see			https://www.freertos.org/xQueueSendToBackFromISR.html
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
  ****************************************************************************/
 template <typename T>
 inline bool Queue<T>::sendToBackFromISR(const T itemToQueue)
 {
-	return (xQueueSendToBackFromISR(handle, (void *) &itemToQueue, NULL) == pdTRUE) ? true : false;
+	return Queue<T>::sendToBackFromISR(itemToQueue, NULL);
 }
 
 /**
@@ -255,11 +510,25 @@ inline bool Queue<T>::sendToBackFromISR(const T itemToQueue)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Uses xQueueSendToFront() instead
+ * 									of xQueueSendToBack()
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
+ * 				- 14.10.2026	NZ	Mod: Counts for the optional queue
+ * 									telemetry
  ****************************************************************************/
 template <typename T>
 inline bool Queue<T>::sendToFront(const T itemToQueue, TickType_t ticksToWait)
 {
-	return (xQueueSendToBack(handle, (void *) &itemToQueue, ticksToWait) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, queueSendToFront);
+	ret = (xQueueSendToFront(handle, (void *) &itemToQueue, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, queueSendToFront, ret);
+	QUEUE_TELEMETRY_SEND((ret == true) ? 1 : 0, (ret == false));
+
+	return ret;
 }
 
 /**
@@ -285,6 +554,33 @@ inline bool Queue<T>::sendToFront(const T itemToQueue)
 	return Queue<T>::sendToFront(itemToQueue, defaultMinTicksToWait);
 }
 
+/**
+ * @brief		Sends item to queue front from an ISR
+ *
+ * @param		itemToQueue					Item to push to front
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Sends an item to the front of the queue from an interrupt
+ * 				service routine, it has no delay because it doesn't block.
+ * 				If sending unblocks a task with a higher priority than the
+ * 				interrupted one, `higherPriorityTaskWoken` is set to pdTRUE.
+ * @see			https://www.freertos.org/xQueueSendToFrontFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::sendToFrontFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken)
+{
+	bool ret; // Temporary return value
+
+	ret = (xQueueSendToFrontFromISR(handle, (void *) &itemToQueue, higherPriorityTaskWoken) == pdTRUE) ? true : false;
+	QUEUE_TELEMETRY_SEND_FROM_ISR((ret == true) ? 1 : 0, (ret == false));
+
+	return ret;
+}
+
 /**
  * @brief		Sends item to queue front from an ISR
  *
@@ -294,16 +590,20 @@ inline bool Queue<T>::sendToFront(const T itemToQueue)
  * @details		Sends an item to the front of the queue from an interrupt
  * 				service routine, it has no delay because it doesn't block.
  * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
- * 				and is constant set to `NULL`.
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
  * @see			https://www.freertos.org/xQueueSendToFrontFromISR.html
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
  ****************************************************************************/
 template <typename T>
 inline bool Queue<T>::sendToFrontFromISR(const T itemToQueue)
 {
-	return (xQueueSendToBackFromISR(handle, (void *) &itemToQueue, NULL) == pdTRUE) ? true : false;
+	return Queue<T>::sendToFrontFromISR(itemToQueue, NULL);
 }
 
 /**
@@ -315,10 +615,17 @@ inline bool Queue<T>::sendToFrontFromISR(const T itemToQueue)
  * @details		Receives an item form the queue, waits the given amount of
  * 				time and blocks the task. It's create a local buffer and
  * 				returns the item of the queue.
+ * @warning		Asserts that an item was received, so a timeout aborts. Use
+ * 				tryReceive() or receiveOptional() if the time may expire.
  * @see			https://www.freertos.org/a00118.html
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
+ * 				- 14.10.2026	NZ	Mod: Counts for the optional queue
+ * 									telemetry
  ****************************************************************************/
 template <typename T>
 inline T Queue<T>::receive(TickType_t ticksToWait)
@@ -326,7 +633,10 @@ inline T Queue<T>::receive(TickType_t ticksToWait)
 	T buffer; // Create local buffer
 	BaseType_t ret; // Temporary return value
 
+	WRAPPER_TRACE_ENTER(handle, queueReceive);
 	ret = xQueueReceive(handle, &buffer, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, queueReceive, (ret == pdTRUE));
+	QUEUE_TELEMETRY_RECEIVE((ret == pdTRUE) ? 1 : 0, (ret != pdTRUE));
 
 	assert(ret == pdTRUE);
 
@@ -360,26 +670,601 @@ inline T Queue<T>::receive(void)
 /**
  * @brief		Receives items to a defined buffer from an ISR
  *
- * @param		buffer			Buffer to store the message in
- * @param		ticksToWait		Ticks to wait to complete
- * @return		The start of the message as `void` pointer
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		The item of the queue
+ *
+ * @details		Receives an item form the queue, from an interrupt service
+ * 				routine, it has no delay because it doesn't block. It's create
+ * 				a local buffer and returns the item of the queue. If receiving
+ * 				unblocks a task waiting for space, with a higher priority than
+ * 				the interrupted one, `higherPriorityTaskWoken` is set to pdTRUE.
+ * 				Unlike receive() it doesn't assert, an ISR may poll the queue.
+ * 				If the queue is empty, a default constructed item is returned,
+ * 				use tryReceiveFromISR() to tell it from a received one.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline T Queue<T>::receiveFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	T buffer{}; // Create local buffer
+	BaseType_t ret; // Temporary return value
+
+	ret = xQueueReceiveFromISR(handle, &buffer, higherPriorityTaskWoken);
+	QUEUE_TELEMETRY_RECEIVE_FROM_ISR((ret == pdTRUE) ? 1 : 0);
+
+	return buffer;
+}
+
+/**
+ * @brief		Receives items to a defined buffer from an ISR
+ *
+ * @param		void
+ * @return		The item of the queue
  *
  * @details		Receives an item form the queue, from an interrupt service
  * 				routine, it has no delay because it doesn't block. It's create
  * 				a local buffer and returns the item of the queue.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
  * @see			https://www.freertos.org/a00120.html
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
  ****************************************************************************/
 template <typename T>
 inline T Queue<T>::receiveFromISR(void)
 {
-	T buffer; // Create local buffer
+	return Queue<T>::receiveFromISR(NULL);
+}
 
-	xQueueReceiveFromISR(handle, &buffer, NULL);
+/**
+ * @brief		Receives an item into a reference and waits the given ticks
+ *
+ * @param		item			Stores the received item
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Receives an item from the queue and waits the given amount of
+ * 				time. Unlike receive() it doesn't assert, on a timeout `item`
+ * 				is not changed. The item is copied directly into `item`,
+ * 				without a local buffer.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::tryReceive(T &item, TickType_t ticksToWait)
+{
+	return Queue<T>::receiveInto(&item, ticksToWait);
+}
 
-	return buffer;
+/**
+ * @brief		Receives an item into a reference and waits the default ticks
+ *
+ * @param		item			Stores the received item
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Receives an item from the queue and waits the default amount
+ * 				of time. The default value is `portMAX_DELAY`, so it waits the
+ * 				maximum of time.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::tryReceive(T &item)
+{
+	return Queue<T>::tryReceive(item, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives an item into a reference from an ISR
+ *
+ * @param		item						Stores the received item
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if an item was received, false if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block. If the
+ * 				queue is empty, `item` is not changed.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::tryReceiveFromISR(T &item, BaseType_t *higherPriorityTaskWoken)
+{
+	return Queue<T>::receiveIntoFromISR(&item, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Receives an item into a reference from an ISR
+ *
+ * @param		item			Stores the received item
+ * @return		True if an item was received, false if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::tryReceiveFromISR(T &item)
+{
+	return Queue<T>::tryReceiveFromISR(item, NULL);
+}
+
+/**
+ * @brief		Receives an item as optional and waits the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		The item of the queue, or `std::nullopt` if the time expired
+ *
+ * @details		Receives an item from the queue and waits the given amount of
+ * 				time. The item is received into uninitialized storage, so `T`
+ * 				doesn't need to be default constructible and nothing is
+ * 				constructed on a timeout.
+ * @warning		FreeRTOS copies the item byte by byte, so `T` has to be
+ * 				trivially copyable.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline std::optional<T> Queue<T>::receiveOptional(TickType_t ticksToWait)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+	alignas(T) unsigned char buffer[sizeof(T)]; // Uninitialized local buffer
+	BaseType_t ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, queueReceive);
+	ret = xQueueReceive(handle, buffer, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, queueReceive, (ret == pdTRUE));
+	QUEUE_TELEMETRY_RECEIVE((ret == pdTRUE) ? 1 : 0, (ret != pdTRUE));
+
+	if (ret != pdTRUE) {
+		return std::nullopt;
+	}
+
+	return *std::launder(reinterpret_cast<T *>(buffer));
+}
+
+/**
+ * @brief		Receives an item as optional and waits the default ticks
+ *
+ * @param		void
+ * @return		The item of the queue, or `std::nullopt` if the time expired
+ *
+ * @details		Receives an item from the queue and waits the default amount
+ * 				of time. The default value is `portMAX_DELAY`, so it waits the
+ * 				maximum of time.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline std::optional<T> Queue<T>::receiveOptional(void)
+{
+	return Queue<T>::receiveOptional(defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives an item as optional from an ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		The item of the queue, or `std::nullopt` if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block.
+ * @warning		FreeRTOS copies the item byte by byte, so `T` has to be
+ * 				trivially copyable.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline std::optional<T> Queue<T>::receiveOptionalFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+	alignas(T) unsigned char buffer[sizeof(T)]; // Uninitialized local buffer
+	BaseType_t ret; // Temporary return value
+
+	ret = xQueueReceiveFromISR(handle, buffer, higherPriorityTaskWoken);
+	QUEUE_TELEMETRY_RECEIVE_FROM_ISR((ret == pdTRUE) ? 1 : 0);
+
+	if (ret != pdTRUE) {
+		return std::nullopt;
+	}
+
+	return *std::launder(reinterpret_cast<T *>(buffer));
+}
+
+/**
+ * @brief		Receives an item as optional from an ISR
+ *
+ * @param		void
+ * @return		The item of the queue, or `std::nullopt` if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline std::optional<T> Queue<T>::receiveOptionalFromISR(void)
+{
+	return Queue<T>::receiveOptionalFromISR(NULL);
+}
+
+/**
+ * @brief		Receives an item directly into the given storage and waits the given ticks
+ *
+ * @param		buffer			Storage of at least `sizeof(T)` bytes for the item
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Receives an item from the queue and waits the given amount of
+ * 				time. The item is copied by FreeRTOS directly into `buffer`,
+ * 				nothing is constructed or copied in between, e.g. into a slot
+ * 				of a caller side array. On a timeout `buffer` is not changed.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::receiveInto(T *buffer, TickType_t ticksToWait)
+{
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, queueReceive);
+	ret = (xQueueReceive(handle, (void *) buffer, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, queueReceive, ret);
+	QUEUE_TELEMETRY_RECEIVE((ret == true) ? 1 : 0, (ret == false));
+
+	return ret;
+}
+
+/**
+ * @brief		Receives an item directly into the given storage and waits the default ticks
+ *
+ * @param		buffer			Storage of at least `sizeof(T)` bytes for the item
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Receives an item from the queue and waits the default amount
+ * 				of time. The default value is `portMAX_DELAY`, so it waits the
+ * 				maximum of time.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::receiveInto(T *buffer)
+{
+	return Queue<T>::receiveInto(buffer, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives an item directly into the given storage from an ISR
+ *
+ * @param		buffer						Storage of at least `sizeof(T)` bytes for the item
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if an item was received, false if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block. If
+ * 				receiving unblocks a task waiting for space, with a higher
+ * 				priority than the interrupted one, `higherPriorityTaskWoken`
+ * 				is set to pdTRUE.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::receiveIntoFromISR(T *buffer, BaseType_t *higherPriorityTaskWoken)
+{
+	bool ret; // Temporary return value
+
+	ret = (xQueueReceiveFromISR(handle, (void *) buffer, higherPriorityTaskWoken) == pdTRUE) ? true : false;
+	QUEUE_TELEMETRY_RECEIVE_FROM_ISR((ret == true) ? 1 : 0);
+
+	return ret;
+}
+
+/**
+ * @brief		Receives an item directly into the given storage from an ISR
+ *
+ * @param		buffer			Storage of at least `sizeof(T)` bytes for the item
+ * @return		True if an item was received, false if the queue is empty
+ *
+ * @details		Receives an item from the queue from an interrupt service
+ * 				routine, it has no delay because it doesn't block.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::receiveIntoFromISR(T *buffer)
+{
+	return Queue<T>::receiveIntoFromISR(buffer, NULL);
+}
+
+/**
+ * @brief		Reads the item at the front of the queue and waits the given ticks
+ *
+ * @param		item			Stores the item at the front of the queue
+ * @param		ticksToWait		Ticks to wait for an item
+ * @return		True if an item was read, false if the time expired
+ *
+ * @details		Copies the item at the front of the queue into `item` without
+ * 				removing it from the queue. If the time expires, `item` is not
+ * 				changed.
+ * @see			https://www.freertos.org/xQueuePeek.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::peek(T &item, TickType_t ticksToWait)
+{
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, queuePeek);
+	ret = (xQueuePeek(handle, (void *) &item, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, queuePeek, ret);
+
+	return ret;
+}
+
+/**
+ * @brief		Reads the item at the front of the queue and waits the default ticks
+ *
+ * @param		item			Stores the item at the front of the queue
+ * @return		True if an item was read, false if the time expired
+ *
+ * @details		Copies the item at the front of the queue into `item` without
+ * 				removing it from the queue. The default value is `0`, so it
+ * 				doesn't block.
+ * @see			https://www.freertos.org/xQueuePeek.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::peek(T &item)
+{
+	return Queue<T>::peek(item, defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Reads the item at the front of the queue from an ISR
+ *
+ * @param		item			Stores the item at the front of the queue
+ * @return		True if an item was read, false if the queue is empty
+ *
+ * @details		Copies the item at the front of the queue into `item` without
+ * 				removing it, from an interrupt service routine. Peeking never
+ * 				unblocks a task, so there is no `higherPriorityTaskWoken`.
+ * @see			https://www.freertos.org/xQueuePeekFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::peekFromISR(T &item)
+{
+	return (xQueuePeekFromISR(handle, (void *) &item) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Sends several items to queue back and waits the given ticks
+ *
+ * @param		itemsToQueue	Array of items to push to back
+ * @param		numberOfItems	Number of items in the array
+ * @param		ticksToWait		Ticks to wait in total to complete
+ * @return		Number of items sent
+ *
+ * @details		Sends the items in order to the back of the queue. Every item
+ * 				is first sent without blocking, only if the queue is full the
+ * 				task blocks for the remaining time of `ticksToWait`. So the
+ * 				whole batch waits at most `ticksToWait` and not per item.
+ * @see			https://www.freertos.org/xQueueSendToBack.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::sendBatch(const T *itemsToQueue, size_t numberOfItems, TickType_t ticksToWait)
+{
+	size_t sent = 0; // Number of items sent
+	TimeOut_t timeOut; // Start time of the batch
+
+	vTaskSetTimeOutState(&timeOut);
+
+	while (sent < numberOfItems) {
+		if (xQueueSendToBack(handle, (void *) &itemsToQueue[sent], 0) != pdTRUE) {
+			if (xTaskCheckForTimeOut(&timeOut, &ticksToWait) == pdTRUE) {
+				break;
+			}
+
+			if (xQueueSendToBack(handle, (void *) &itemsToQueue[sent], ticksToWait) != pdTRUE) {
+				break;
+			}
+		}
+
+		sent++;
+	}
+
+	QUEUE_TELEMETRY_SEND(sent, (sent < numberOfItems));
+
+	return sent;
+}
+
+/**
+ * @brief		Sends several items to queue back and waits the default ticks
+ *
+ * @param		itemsToQueue	Array of items to push to back
+ * @param		numberOfItems	Number of items in the array
+ * @return		Number of items sent
+ *
+ * @details		Sends the items in order to the back of the queue and waits
+ * 				the default amount of time. The default value is `0`, so only
+ * 				as many items as there are spaces available are sent.
+ * @see			https://www.freertos.org/xQueueSendToBack.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::sendBatch(const T *itemsToQueue, size_t numberOfItems)
+{
+	return Queue<T>::sendBatch(itemsToQueue, numberOfItems, defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Sends several items to queue back from an ISR
+ *
+ * @param		itemsToQueue				Array of items to push to back
+ * @param		numberOfItems				Number of items in the array
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Number of items sent
+ *
+ * @details		Sends the items in order to the back of the queue from an
+ * 				interrupt service routine, until the queue is full. The woken
+ * 				flag is collected over all items, so only one context switch
+ * 				is requested for the whole batch.
+ * @see			https://www.freertos.org/xQueueSendToBackFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::sendBatchFromISR(const T *itemsToQueue, size_t numberOfItems, BaseType_t *higherPriorityTaskWoken)
+{
+	size_t sent = 0; // Number of items sent
+
+	while ((sent < numberOfItems) && (xQueueSendToBackFromISR(handle, (void *) &itemsToQueue[sent], higherPriorityTaskWoken) == pdTRUE)) {
+		sent++;
+	}
+
+	QUEUE_TELEMETRY_SEND_FROM_ISR(sent, (sent < numberOfItems));
+
+	return sent;
+}
+
+/**
+ * @brief		Receives several items and waits the given ticks for the first
+ *
+ * @param		buffer				Array to store the items in
+ * @param		maxItems			Maximum number of items to receive
+ * @param		firstTicksToWait	Ticks to wait for the first item
+ * @return		Number of items received
+ *
+ * @details		Blocks until the first item is available or the time expired,
+ * 				then drains the items already waiting without blocking again.
+ * 				The items are written directly into the buffer.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::receiveBatch(T *buffer, size_t maxItems, TickType_t firstTicksToWait)
+{
+	size_t received = 0; // Number of items received
+
+	if ((maxItems == 0) || (xQueueReceive(handle, &buffer[0], firstTicksToWait) != pdTRUE)) {
+		QUEUE_TELEMETRY_RECEIVE(0, true);
+		return 0;
+	}
+
+	received++;
+
+	while ((received < maxItems) && (xQueueReceive(handle, &buffer[received], 0) == pdTRUE)) {
+		received++;
+	}
+
+	QUEUE_TELEMETRY_RECEIVE(received, false);
+
+	return received;
+}
+
+/**
+ * @brief		Receives several items and waits the default ticks for the first
+ *
+ * @param		buffer			Array to store the items in
+ * @param		maxItems		Maximum number of items to receive
+ * @return		Number of items received
+ *
+ * @details		Blocks the default amount of time for the first item, then
+ * 				drains the items already waiting. The default value is
+ * 				`portMAX_DELAY`, so it waits the maximum of time.
+ * @see			https://www.freertos.org/a00118.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::receiveBatch(T *buffer, size_t maxItems)
+{
+	return Queue<T>::receiveBatch(buffer, maxItems, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives several items from an ISR
+ *
+ * @param		buffer						Array to store the items in
+ * @param		maxItems					Maximum number of items to receive
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Number of items received
+ *
+ * @details		Drains up to `maxItems` items from the queue, from an
+ * 				interrupt service routine, it has no delay because it doesn't
+ * 				block.
+ * @see			https://www.freertos.org/a00120.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline size_t Queue<T>::receiveBatchFromISR(T *buffer, size_t maxItems, BaseType_t *higherPriorityTaskWoken)
+{
+	size_t received = 0; // Number of items received
+
+	while ((received < maxItems) && (xQueueReceiveFromISR(handle, &buffer[received], higherPriorityTaskWoken) == pdTRUE)) {
+		received++;
+	}
+
+	QUEUE_TELEMETRY_RECEIVE_FROM_ISR(received);
+
+	return received;
 }
 
 /**
@@ -439,6 +1324,42 @@ inline UBaseType_t Queue<T>::spacesAvailable(void)
 	return uxQueueSpacesAvailable(handle);
 }
 
+/**
+ * @brief		Checks if the queue is full, from an ISR
+ *
+ * @param		void
+ * @return		True if the queue is full, false otherwise
+ *
+ * @details		Queries the queue from an interrupt service routine.
+ * @see			https://www.freertos.org/a00018.html#xQueueIsQueueFullFromISR
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::isFullFromISR(void)
+{
+	return (xQueueIsQueueFullFromISR(handle) == pdFALSE) ? false : true;
+}
+
+/**
+ * @brief		Checks if the queue is empty, from an ISR
+ *
+ * @param		void
+ * @return		True if the queue is empty, false otherwise
+ *
+ * @details		Queries the queue from an interrupt service routine.
+ * @see			https://www.freertos.org/a00018.html#xQueueIsQueueEmptyFromISR
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T>
+inline bool Queue<T>::isEmptyFromISR(void)
+{
+	return (xQueueIsQueueEmptyFromISR(handle) == pdFALSE) ? false : true;
+}
+
 /**
  * @brief		Used to set the default max ticks
  *
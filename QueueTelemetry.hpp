@@ -0,0 +1,417 @@
+#ifndef QUEUETELEMETRY_HPP_
+#define QUEUETELEMETRY_HPP_
+/****************************************************************************/
+/*  Header    : Queue Telemetry Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : QueueTelemetry.hpp											*/
+/*                                                                          */
+/*  @brief	  : Opt-in fill level and throughput statistics for Queue and	*/
+/*				QueueStatic													*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- 14.10.2026	NZ	Mod: Counted by hooks in Queue, named	*/
+/*									queues are in the registry by default	*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <FreeRTOS.h>
+#include <queue.h>
+#include <task.h>
+
+/* Class constant declaration  */
+#ifndef configUSE_QUEUE_TELEMETRY
+#define configUSE_QUEUE_TELEMETRY		0
+#endif
+
+#if (configUSE_QUEUE_TELEMETRY == 1)
+#define QUEUE_TELEMETRY_SEND(items, full)				((telemetry != NULL) ? telemetry->countSend((UBaseType_t) (items), (full)) : (void) 0)
+#define QUEUE_TELEMETRY_SEND_FROM_ISR(items, full)		((telemetry != NULL) ? telemetry->countSendFromISR((UBaseType_t) (items), (full)) : (void) 0)
+#define QUEUE_TELEMETRY_RECEIVE(items, timeout)			((telemetry != NULL) ? telemetry->countReceive((UBaseType_t) (items), (timeout)) : (void) 0)
+#define QUEUE_TELEMETRY_RECEIVE_FROM_ISR(items)			((telemetry != NULL) ? telemetry->countReceiveFromISR((UBaseType_t) (items), false) : (void) 0)
+#else
+#define QUEUE_TELEMETRY_SEND(items, full)				((void) (items), (void) (full))
+#define QUEUE_TELEMETRY_SEND_FROM_ISR(items, full)		((void) (items), (void) (full))
+#define QUEUE_TELEMETRY_RECEIVE(items, timeout)			((void) (items), (void) (timeout))
+#define QUEUE_TELEMETRY_RECEIVE_FROM_ISR(items)			((void) (items))
+#endif
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configUSE_QUEUE_TELEMETRY == 1)
+/* Class definition            */
+class QueueTelemetryBase
+{
+protected:
+	QueueHandle_t						queueHandle;
+	char								queueName[configMAX_TASK_NAME_LEN] = {};
+	UBaseType_t							queueLength;
+
+	uint32_t							sentCount = 0;
+	uint32_t							receivedCount = 0;
+	uint32_t							fullCount = 0;
+	uint32_t							timeoutCount = 0;
+	UBaseType_t							highWaterMark = 0;
+	UBaseType_t							peakSendRate = 0;
+	UBaseType_t							sendRate = 0;
+	TickType_t							sendRateTick = 0;
+
+	QueueTelemetryBase					*nextQueue = NULL;
+	inline static QueueTelemetryBase	*firstQueue = NULL;
+
+	template <typename T>
+	friend class Queue;
+
+	QueueTelemetryBase(QueueHandle_t handle, std::string_view name, UBaseType_t length);
+	~QueueTelemetryBase(void);
+
+	void countSend(UBaseType_t items, bool full, UBaseType_t waiting, TickType_t now);
+
+	void countSend(UBaseType_t items, bool full);
+	void countSendFromISR(UBaseType_t items, bool full);
+
+	void countReceive(UBaseType_t items, bool timeout);
+	void countReceiveFromISR(UBaseType_t items, bool timeout);
+
+public:
+	const char *getName(void)												{return queueName;};
+	UBaseType_t getLength(void)												{return queueLength;};
+	UBaseType_t getMessagesWaiting(void)									{return uxQueueMessagesWaiting(queueHandle);};
+
+	uint32_t getSentCount(void)												{return sentCount;};
+	uint32_t getReceivedCount(void)											{return receivedCount;};
+	uint32_t getFullCount(void)												{return fullCount;};
+	uint32_t getTimeoutCount(void)											{return timeoutCount;};
+	UBaseType_t getHighWaterMark(void)										{return highWaterMark;};
+	UBaseType_t getPeakSendRate(void)										{return peakSendRate;};
+
+	void resetStatistics(void);
+
+	void static dump(void (*callback)(QueueTelemetryBase &queue, void *context), void *context);
+};
+
+template <typename QueueType>
+class QueueTelemetry : public QueueType, public QueueTelemetryBase
+{
+public:
+	QueueTelemetry(std::string_view queueName = {});
+	QueueTelemetry(UBaseType_t queueLength, std::string_view queueName = {});
+
+	~QueueTelemetry(void);
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		handle			Handle of the queue
+ * @param		name			Name of the queue for dump()
+ * @param		length			Length of the queue (max. items in queue)
+ *
+ * @details		Copies the name and appends the queue to the list of all
+ * 				instrumented queues, so dump() can report it. The scheduler is
+ * 				suspended while the list is changed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline QueueTelemetryBase::QueueTelemetryBase(QueueHandle_t handle, std::string_view name, UBaseType_t length)
+	:	queueHandle(handle),
+		queueLength(length)
+{
+	name.copy(queueName, sizeof(queueName) - 1);
+
+	vTaskSuspendAll();
+	nextQueue = firstQueue;
+	firstQueue = this;
+	xTaskResumeAll();
+}
+
+/**
+ * @brief		Destructor
+ *
+ * @details		Removes the queue from the list of all instrumented queues.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline QueueTelemetryBase::~QueueTelemetryBase(void)
+{
+	QueueTelemetryBase **link = &firstQueue; // Link that points to the current queue
+
+	vTaskSuspendAll();
+	while (*link != NULL) {
+		if (*link == this) {
+			*link = nextQueue;
+			break;
+		}
+
+		link = &(*link)->nextQueue;
+	}
+	xTaskResumeAll();
+}
+
+/**
+ * @brief		Counts sent items, the caller holds the critical section
+ *
+ * @param		items			Number of items that were sent
+ * @param		full			True if the queue was full and not all items were sent
+ * @param		waiting			Number of items in the queue after the send
+ * @param		now				Current tick count
+ * @return		void
+ *
+ * @details		Updates the totals and the high water mark of the fill level.
+ * 				The send rate is the number of items sent within the same
+ * 				tick, its maximum is the peak burst the queue had to absorb.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::countSend(UBaseType_t items, bool full, UBaseType_t waiting, TickType_t now)
+{
+	sentCount += items;
+
+	if (full == true) {
+		fullCount++;
+	}
+
+	if (waiting > highWaterMark) {
+		highWaterMark = waiting;
+	}
+
+	if (now != sendRateTick) {
+		sendRateTick = now;
+		sendRate = 0;
+	}
+
+	sendRate += items;
+
+	if (sendRate > peakSendRate) {
+		peakSendRate = sendRate;
+	}
+}
+
+/**
+ * @brief		Counts sent items
+ *
+ * @param		items			Number of items that were sent
+ * @param		full			True if the queue was full and not all items were sent
+ * @return		void
+ *
+ * @details		Reads the fill level and the tick count and updates the
+ * 				statistics inside a critical section.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::countSend(UBaseType_t items, bool full)
+{
+	taskENTER_CRITICAL();
+	countSend(items, full, uxQueueMessagesWaiting(queueHandle), xTaskGetTickCount());
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Counts sent items from an ISR
+ *
+ * @param		items			Number of items that were sent
+ * @param		full			True if the queue was full and not all items were sent
+ * @return		void
+ *
+ * @details		Like countSend(), but with the FromISR API functions.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::countSendFromISR(UBaseType_t items, bool full)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	countSend(items, full, uxQueueMessagesWaitingFromISR(queueHandle), xTaskGetTickCountFromISR());
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Counts received items
+ *
+ * @param		items			Number of items that were received
+ * @param		timeout			True if nothing was received within the time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::countReceive(UBaseType_t items, bool timeout)
+{
+	taskENTER_CRITICAL();
+	receivedCount += items;
+
+	if (timeout == true) {
+		timeoutCount++;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Counts received items from an ISR
+ *
+ * @param		items			Number of items that were received
+ * @param		timeout			True if nothing was received within the time
+ * @return		void
+ *
+ * @details		An ISR never waits, so an empty queue is not a timeout and
+ * 				`timeout` is false for all FromISR methods.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::countReceiveFromISR(UBaseType_t items, bool timeout)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	receivedCount += items;
+
+	if (timeout == true) {
+		timeoutCount++;
+	}
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Resets the statistics
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Sets all counters back to zero and the high water mark to the
+ * 				current fill level, e.g. after the start up phase.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::resetStatistics(void)
+{
+	taskENTER_CRITICAL();
+	sentCount = 0;
+	receivedCount = 0;
+	fullCount = 0;
+	timeoutCount = 0;
+	highWaterMark = uxQueueMessagesWaiting(queueHandle);
+	peakSendRate = 0;
+	sendRate = 0;
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Reports all instrumented queues
+ *
+ * @param		callback		Function called once for every queue
+ * @param		context			Pointer passed through to the callback
+ * @return		void
+ *
+ * @details		Walks the list of all QueueTelemetry objects, e.g. to print
+ * 				the name, length and high water mark of every queue to size
+ * 				them from measured values. The scheduler is suspended
+ * 				during the walk, so no queue is created or deleted meanwhile.
+ * @warning		The callback must not block, because the scheduler is
+ * 				suspended while it's called.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void QueueTelemetryBase::dump(void (*callback)(QueueTelemetryBase &queue, void *context), void *context)
+{
+	vTaskSuspendAll();
+	for (QueueTelemetryBase *queue = firstQueue; queue != NULL; queue = queue->nextQueue) {
+		callback(*queue, context);
+	}
+	xTaskResumeAll();
+}
+
+/**
+ * @brief		Constructor, static queue
+ *
+ * @param		queueName		Name of the queue for dump() and the registry
+ *
+ * @details		Constructs a QueueStatic like queue and adds it to the list of
+ * 				dump(). The queue counts every call through its hooks in
+ * 				Queue, also through a pointer or reference to the plain
+ * 				queue type. With a name and `configQUEUE_REGISTRY_SIZE`
+ * 				greater than 0 the queue is also added to the registry of the
+ * 				kernel aware debugger, e.g.
+ * 				`QueueTelemetry<QueueStatic<Message, 16>> rxQueue("rx");`
+ * @warning		Needs `configUSE_QUEUE_TELEMETRY` set to 1, otherwise the
+ * 				class and the hooks in Queue don't exist.
+ * @see			https://www.freertos.org/vQueueAddToRegistry.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Named queues are in the registry
+ * 									by default, counted by the Queue hooks
+ ****************************************************************************/
+template <typename QueueType>
+inline QueueTelemetry<QueueType>::QueueTelemetry(std::string_view queueName)
+	:	QueueType((configQUEUE_REGISTRY_SIZE > 0) && (queueName.empty() == false), queueName),
+		QueueTelemetryBase(this->handle, queueName, this->length)
+{
+	this->telemetry = this;
+}
+
+/**
+ * @brief		Constructor, dynamic queue
+ *
+ * @param		queueLength		Length of the queue (max. items in queue)
+ * @param		queueName		Name of the queue for dump() and the registry
+ *
+ * @details		Like the constructor of the static queue, for a Queue that is
+ * 				allocated from the heap with `queueLength` items.
+ * @see			https://www.freertos.org/vQueueAddToRegistry.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename QueueType>
+inline QueueTelemetry<QueueType>::QueueTelemetry(UBaseType_t queueLength, std::string_view queueName)
+	:	QueueType(queueLength, (configQUEUE_REGISTRY_SIZE > 0) && (queueName.empty() == false), queueName),
+		QueueTelemetryBase(this->handle, queueName, this->length)
+{
+	this->telemetry = this;
+}
+
+/**
+ * @brief		Destructor
+ *
+ * @details		Detaches the statistics from the queue before the list entry
+ * 				and then the queue are removed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename QueueType>
+inline QueueTelemetry<QueueType>::~QueueTelemetry(void)
+{
+	this->telemetry = NULL;
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Queue Telemetry Class										*/
+/****************************************************************************/
+#endif /* QUEUETELEMETRY_HPP_ */
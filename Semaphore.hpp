@@ -13,7 +13,17 @@
 /*  @date	  : 21.04.2023  NZ	Created                              		*/
 /*                                                                          */
 /*	@remark	  : Last Modifications:											*/
-/* 				- none														*/
+/*				- 14.10.2026	NZ	Add: Static allocation, SemaphoreStatic	*/
+/*									class									*/
+/*				- 14.10.2026	NZ	Add: FromISR methods with the			*/
+/*									pxHigherPriorityTaskWoken parameter		*/
+/*				- 14.10.2026	NZ	Add: Constructor to take over a handle	*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Add: Optional trace of the blocking calls*/
+/*				- 14.10.2026	NZ	Fix: Counting semaphores start with		*/
+/*									initialCount, no extra give()			*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
 /*																			*/
 /*  @todo	  :	- Test the whole class extensively							*/
 /*																			*/
@@ -22,8 +32,14 @@
 /****************************************************************************/
 
 /* imports */
+#include <chrono>
+
+#include <FreeRTOS.h>
 #include <semphr.h>
 
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -39,9 +55,18 @@ protected:
 
 	TickType_t				defaultBlockTime = 0;
 
+	Semaphore(SemaphoreHandle_t semaphoreHandle, UBaseType_t maxCount);
+
 public:
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 	Semaphore(void);
 	Semaphore(UBaseType_t maxCount, UBaseType_t initialCount);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	Semaphore(StaticSemaphore_t *semaphoreBuffer);
+	Semaphore(UBaseType_t maxCount, UBaseType_t initialCount, StaticSemaphore_t *semaphoreBuffer);
+#endif
 
 	~Semaphore(void);
 
@@ -50,15 +75,33 @@ public:
 	UBaseType_t getCount(void);
 
 	bool take(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool take(const std::chrono::duration<Rep, Period> timeToWait)							{return take(convertToTicks(timeToWait));};
 	bool take(void);
 
+	bool takeFromISR(BaseType_t *higherPriorityTaskWoken);
 	bool takeFromISR(void);
 
 	bool give(void);
 
+	bool giveFromISR(BaseType_t *higherPriorityTaskWoken);
 	bool giveFromISR(void);
 };
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+class SemaphoreStatic : public Semaphore
+{
+protected:
+	StaticSemaphore_t		semaphoreBuffer;
+
+public:
+	SemaphoreStatic(void);
+	SemaphoreStatic(UBaseType_t maxCount, UBaseType_t initialCount);
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 /**
  * @brief		Constructor binary semaphore
  *
@@ -98,10 +141,107 @@ inline Semaphore::Semaphore(UBaseType_t maxSemphrCount, UBaseType_t initialCount
 	handle = xSemaphoreCreateCounting(maxCount, initialCount);
 
 	assert(handle != NULL);
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor binary semaphore, with static memory
+ *
+ * @param		semaphoreBuffer		Used to hold the semaphore's data structure
+ *
+ * @details		Constructs a new binary semaphore object with the FreeRTOS API
+ * 				function xSemaphoreCreateBinaryStatic(). No memory is allocated
+ * 				from the FreeRTOS heap.
+ * @see			https://www.freertos.org/xSemaphoreCreateBinaryStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Semaphore::Semaphore(StaticSemaphore_t *semaphoreBuffer): maxCount(1)
+{
+	handle = xSemaphoreCreateBinaryStatic(semaphoreBuffer);
+
+	assert(handle != NULL);
 
 	give();
 };
 
+/**
+ * @brief		Constructor counting semaphore, with static memory
+ *
+ * @param		maxSemphrCount		The maximum count value that can be reached
+ * @param		initialCount		The value assigned to the semaphore when it is created
+ * @param		semaphoreBuffer		Used to hold the semaphore's data structure
+ *
+ * @details		Constructs a new counting semaphore object with the FreeRTOS
+ * 				API function xSemaphoreCreateCountingStatic(). No memory is
+ * 				allocated from the FreeRTOS heap.
+ * @see			https://www.freertos.org/xSemaphoreCreateCountingStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Semaphore::Semaphore(UBaseType_t maxSemphrCount, UBaseType_t initialCount, StaticSemaphore_t *semaphoreBuffer): maxCount(maxSemphrCount)
+{
+	handle = xSemaphoreCreateCountingStatic(maxCount, initialCount, semaphoreBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor static binary semaphore
+ *
+ * @param		void
+ *
+ * @details		Constructs a new binary semaphore object, the semaphore
+ * 				structure is a member of the object.
+ * @see			https://www.freertos.org/xSemaphoreCreateBinaryStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline SemaphoreStatic::SemaphoreStatic(void): Semaphore(&semaphoreBuffer)
+{
+};
+
+/**
+ * @brief		Constructor static counting semaphore
+ *
+ * @param		maxSemphrCount		The maximum count value that can be reached
+ * @param		initialCount		The value assigned to the semaphore when it is created
+ *
+ * @details		Constructs a new counting semaphore object, the semaphore
+ * 				structure is a member of the object.
+ * @see			https://www.freertos.org/xSemaphoreCreateCountingStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline SemaphoreStatic::SemaphoreStatic(UBaseType_t maxSemphrCount, UBaseType_t initialCount): Semaphore(maxSemphrCount, initialCount, &semaphoreBuffer)
+{
+};
+#endif
+
+/**
+ * @brief		Constructor from an existing handle
+ *
+ * @param		semaphoreHandle		Handle of an already created semaphore
+ * @param		maxSemphrCount		The maximum count value that can be reached
+ *
+ * @details		Constructs a new semaphore object around a handle, that was
+ * 				created by the derived class, e.g. with
+ * 				xSemaphoreCreateMutex(). The object takes over the ownership
+ * 				of the handle and deletes it in the destructor.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Semaphore::Semaphore(SemaphoreHandle_t semaphoreHandle, UBaseType_t maxSemphrCount): handle(semaphoreHandle), maxCount(maxSemphrCount)
+{
+	assert(handle != NULL);
+};
+
 /**
  * @brief		Destructor
  *
@@ -127,7 +267,8 @@ inline Semaphore::~Semaphore(void)
  *
  * @details		Can be used reliably to determine if the calling task is the
  * 				mutex holder, but cannot be used reliably if the mutex is held
- * 				by any task other than the calling task.
+ * 				by any task other than the calling task. Returns NULL if the
+ * 				semaphore is not a mutex (`Mutex` or `MutexRecursive`).
  * @see			https://www.freertos.org/xSemaphoreGetMutexHolder.html
  *
  * @author		N. Zoller (NZ)
@@ -171,10 +312,19 @@ inline UBaseType_t Semaphore::getCount(void)
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Semaphore::take(TickType_t ticksToWait)
 {
-	return (xSemaphoreTake(handle, ticksToWait) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, semaphoreTake);
+	ret = (xSemaphoreTake(handle, ticksToWait) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, semaphoreTake, ret);
+
+	return ret;
 }
 
 /**
@@ -197,6 +347,28 @@ inline bool Semaphore::take(void)
 	return Semaphore::take(defaultBlockTime);
 }
 
+/**
+ * @brief		Obtain a semaphore from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Method to obtain a semaphore from an interrupt service routine.
+ * 				The semaphore must have previously been created with a call to
+ * 				xSemaphoreCreateBinary() or xSemaphoreCreateCounting(). If
+ * 				taking the semaphore unblocks a task with a higher priority
+ * 				than the interrupted one, `higherPriorityTaskWoken` is set to
+ * 				pdTRUE.
+ * @see			https://www.freertos.org/xSemaphoreTakeFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Semaphore::takeFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	return (xSemaphoreTakeFromISR(handle, higherPriorityTaskWoken) == pdTRUE) ? true : false;
+}
+
 /**
  * @brief		Obtain a semaphore from ISR
  *
@@ -207,14 +379,19 @@ inline bool Semaphore::take(void)
  * 				The semaphore must have previously been created with a call to
  * 				xSemaphoreCreateBinary(), xSemaphoreCreateMutex() or
  * 				xSemaphoreCreateCounting().
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
  * @see			https://www.freertos.org/xSemaphoreTakeFromISR.html
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
  ****************************************************************************/
 inline bool Semaphore::takeFromISR(void)
 {
-	return (xSemaphoreTakeFromISR(handle, NULL) == pdTRUE) ? true : false;
+	return Semaphore::takeFromISR(NULL);
 }
 
 /**
@@ -230,10 +407,42 @@ inline bool Semaphore::takeFromISR(void)
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Semaphore::give(void)
 {
-	return (xSemaphoreGive(handle) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, semaphoreGive);
+	ret = (xSemaphoreGive(handle) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, semaphoreGive, ret);
+
+	return ret;
+}
+
+/**
+ * @brief		Release a semaphore from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Method to release a semaphore from an interrupt service routine.
+ * 				The semaphore must have previously been created with a call to
+ * 				xSemaphoreCreateBinary() or xSemaphoreCreateCounting(). If
+ * 				giving the semaphore unblocks a task with a higher priority
+ * 				than the interrupted one, `higherPriorityTaskWoken` is set to
+ * 				pdTRUE and a context switch should be requested before the
+ * 				ISR exits, e.g. with an `IsrContext` object.
+ * @see			https://www.freertos.org/a00124.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Semaphore::giveFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	return (xSemaphoreGiveFromISR(handle, higherPriorityTaskWoken) == pdTRUE) ? true : false;
 }
 
 /**
@@ -246,13 +455,19 @@ inline bool Semaphore::give(void)
  * 				The semaphore must have previously been created with a call to
  * 				xSemaphoreCreateBinary(), xSemaphoreCreateMutex() or
  * 				xSemaphoreCreateCounting().
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
  * @see			https://www.freertos.org/a00124.html
  *
  * @author		N. Zoller (NZ)
  * @date		21.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
  ****************************************************************************/
 inline bool Semaphore::giveFromISR(void)
 {
-	return (xSemaphoreGiveFromISR(handle, NULL) == pdTRUE) ? true : false;
+	return Semaphore::giveFromISR(NULL);
 }
 #endif /* SEMAPHORE_HPP_ */
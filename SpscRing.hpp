@@ -0,0 +1,642 @@
+#ifndef SPSCRING_HPP_
+#define SPSCRING_HPP_
+/****************************************************************************/
+/*  Header    : SPSC Ring Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : SpscRing.hpp												*/
+/*                                                                          */
+/*  @brief	  : Lock-free single producer single consumer ring buffer		*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Add: Non asserting tryReceive()			*/
+/*				- 14.10.2026	NZ	Add: Lock-free check for SMP			*/
+/*				- 14.10.2026	NZ	Mod: Own notification index by default	*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+#ifndef SPSCRING_CACHE_LINE_SIZE
+#define SPSCRING_CACHE_LINE_SIZE	32
+#endif
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+template <typename T, size_t Length, UBaseType_t NotifyIndex = FREERTOS_WAKEUP_NOTIFY_INDEX>
+class SpscRing : public FreeRTOS
+{
+	static_assert((Length >= 2) && ((Length & (Length - 1)) == 0), "Length must be a power of two");
+	static_assert(NotifyIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES, "NotifyIndex out of range");
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+	// Only loads, stores and fences are used, so plain words suffice even without atomic read-modify-write (e.g. RP2040)
+	static_assert((sizeof(std::atomic<size_t>) == sizeof(size_t)) && (alignof(std::atomic<size_t>) == alignof(size_t)), "The indexes must be plain words to share the ring between cores");
+	static_assert((sizeof(std::atomic<TaskHandle_t>) == sizeof(TaskHandle_t)) && (alignof(std::atomic<TaskHandle_t>) == alignof(TaskHandle_t)), "The waiting tasks must be plain words to share the ring between cores");
+#endif
+
+protected:
+	alignas(SPSCRING_CACHE_LINE_SIZE) std::atomic<size_t>		head{0};
+	std::atomic<TaskHandle_t>									waitingProducer{NULL};
+
+	alignas(SPSCRING_CACHE_LINE_SIZE) std::atomic<size_t>		tail{0};
+	std::atomic<TaskHandle_t>									waitingConsumer{NULL};
+
+	alignas(SPSCRING_CACHE_LINE_SIZE) T							buffer[Length];
+
+	TickType_t			defaultMaxTicksToWait = portMAX_DELAY;
+	TickType_t			defaultMinTicksToWait = 0;
+
+	bool push(const T &itemToQueue);
+	bool pop(T &item);
+
+	bool wait(std::atomic<TaskHandle_t> &waitingTask, TimeOut_t *timeOut, TickType_t *ticksToWait);
+
+public:
+	SpscRing(void) {};
+
+	bool sendToBack(const T itemToQueue, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool sendToBack(const T itemToQueue, const std::chrono::duration<Rep, Period> timeToWait)	{return sendToBack(itemToQueue, convertToTicks(timeToWait));};
+	bool sendToBack(const T itemToQueue);
+
+	bool sendToBackFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken);
+	bool sendToBackFromISR(const T itemToQueue);
+
+	T receive(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	T receive(const std::chrono::duration<Rep, Period> timeToWait)						{return receive(convertToTicks(timeToWait));};
+	T receive(void);
+
+	T receiveFromISR(BaseType_t *higherPriorityTaskWoken);
+	T receiveFromISR(void);
+
+	bool tryReceive(T &item, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool tryReceive(T &item, const std::chrono::duration<Rep, Period> timeToWait)	{return tryReceive(item, convertToTicks(timeToWait));};
+	bool tryReceive(T &item);
+
+	bool tryReceiveFromISR(T &item, BaseType_t *higherPriorityTaskWoken);
+	bool tryReceiveFromISR(T &item);
+
+	UBaseType_t messagesWaiting(void);
+
+	UBaseType_t messagesWaitingFromISR(void);
+
+	UBaseType_t spacesAvailable(void);
+
+	void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
+
+	void setDefaultMinTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMinTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMinTicksToWait(convertToTicks(newTimeToWait));};
+};
+
+/**
+ * @brief		Writes an item into the ring
+ *
+ * @param		itemToQueue		Item to push to back
+ * @return		True if it was successful, false if the ring is full
+ *
+ * @details		Only called by the producer. The head is published with
+ * 				release semantics, so the consumer sees the item before it
+ * 				sees the new head. No critical section is used, so producer
+ * 				and consumer can run on different cores without taking the
+ * 				kernel lock of an SMP port.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::push(const T &itemToQueue)
+{
+	size_t currentHead = head.load(std::memory_order_relaxed);
+
+	if ((currentHead - tail.load(std::memory_order_acquire)) == Length) {
+		return false;
+	}
+
+	buffer[currentHead & (Length - 1)] = itemToQueue;
+	head.store(currentHead + 1, std::memory_order_release);
+
+	return true;
+}
+
+/**
+ * @brief		Reads an item from the ring
+ *
+ * @param		item			Buffer to store the item in
+ * @return		True if it was successful, false if the ring is empty
+ *
+ * @details		Only called by the consumer. The tail is published with
+ * 				release semantics, so the producer doesn't overwrite the slot
+ * 				before the item was read. No critical section is used.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::pop(T &item)
+{
+	size_t currentTail = tail.load(std::memory_order_relaxed);
+
+	if (currentTail == head.load(std::memory_order_acquire)) {
+		return false;
+	}
+
+	item = buffer[currentTail & (Length - 1)];
+	tail.store(currentTail + 1, std::memory_order_release);
+
+	return true;
+}
+
+/**
+ * @brief		Blocks the calling task until it is notified or the time expired
+ *
+ * @param		waitingTask		Slot to announce the waiting task to the other side
+ * @param		timeOut			Time out state, set when the operation started
+ * @param		ticksToWait		Remaining ticks to wait, updated on return
+ * @return		False if the time expired, true otherwise
+ *
+ * @details		Announces the calling task and waits for a notification of
+ * 				the other side. The caller has to check the ring again after
+ * 				announcing, so no notification is lost in between. A
+ * 				notification could also be stale, so the caller retries.
+ * 				`NotifyIndex` defaults to FREERTOS_WAKEUP_NOTIFY_INDEX, not to
+ * 				index 0 of Task::notifyGive() and the stream buffers, so their
+ * 				notifications are neither taken here nor woken by stale ones.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::wait(std::atomic<TaskHandle_t> &waitingTask, TimeOut_t *timeOut, TickType_t *ticksToWait)
+{
+	ulTaskNotifyTakeIndexed(NotifyIndex, pdTRUE, *ticksToWait);
+	waitingTask.store(NULL, std::memory_order_relaxed);
+
+	return (xTaskCheckForTimeOut(timeOut, ticksToWait) == pdTRUE) ? false : true;
+}
+
+/**
+ * @brief		Sends item to ring back and waits the given ticks
+ *
+ * @param		itemToQueue		Item to push to back
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Writes the item into the ring. If the ring is full, the task
+ * 				blocks until the consumer has made space or the time expired.
+ * 				A blocked consumer is woken with a task notification. Only
+ * 				then the kernel is called, on an SMP port this is the only
+ * 				place where the lock of the kernel is taken, so a consumer
+ * 				that keeps up costs the other core nothing.
+ * @warning		Only one task or ISR may send to the ring.
+ * @see			https://www.freertos.org/xTaskNotifyGive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::sendToBack(const T itemToQueue, TickType_t ticksToWait)
+{
+	TimeOut_t timeOut; // Start time of the send
+	TaskHandle_t consumer; // Consumer waiting for an item
+	bool ret = push(itemToQueue);
+
+	if ((ret == false) && (ticksToWait != 0)) {
+		vTaskSetTimeOutState(&timeOut);
+
+		while (ret == false) {
+			waitingProducer.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			ret = push(itemToQueue);
+
+			if (ret == true) {
+				waitingProducer.store(NULL, std::memory_order_relaxed);
+			} else if (wait(waitingProducer, &timeOut, &ticksToWait) == false) {
+				ret = push(itemToQueue);
+				break;
+			} else {
+				ret = push(itemToQueue);
+			}
+		}
+	}
+
+	if (ret == true) {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		consumer = waitingConsumer.load(std::memory_order_relaxed);
+
+		if (consumer != NULL) {
+			xTaskNotifyGiveIndexed(consumer, NotifyIndex);
+		}
+	}
+
+	return ret;
+}
+
+/**
+ * @brief		Sends item to ring back and waits the default ticks
+ *
+ * @param		itemToQueue		Item to push to back
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Writes the item into the ring and waits the default amount of
+ * 				time. The default value is `0`, so it waits the minimum of
+ * 				time.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::sendToBack(const T itemToQueue)
+{
+	return SpscRing<T, Length, NotifyIndex>::sendToBack(itemToQueue, defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Sends item to ring back from an ISR
+ *
+ * @param		itemToQueue					Item to push to back
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Writes the item into the ring from an interrupt service
+ * 				routine, it has no delay because it doesn't block. If the
+ * 				consumer was blocked, it is woken with a task notification.
+ * @warning		Only one task or ISR may send to the ring.
+ * @see			https://www.freertos.org/vTaskNotifyGiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::sendToBackFromISR(const T itemToQueue, BaseType_t *higherPriorityTaskWoken)
+{
+	TaskHandle_t consumer; // Consumer waiting for an item
+
+	if (push(itemToQueue) == false) {
+		return false;
+	}
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	consumer = waitingConsumer.load(std::memory_order_relaxed);
+
+	if (consumer != NULL) {
+		vTaskNotifyGiveIndexedFromISR(consumer, NotifyIndex, higherPriorityTaskWoken);
+	}
+
+	return true;
+}
+
+/**
+ * @brief		Sends item to ring back from an ISR
+ *
+ * @param		itemToQueue		Item to push to back
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Writes the item into the ring from an interrupt service
+ * 				routine, it has no delay because it doesn't block.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::sendToBackFromISR(const T itemToQueue)
+{
+	return SpscRing<T, Length, NotifyIndex>::sendToBackFromISR(itemToQueue, NULL);
+}
+
+/**
+ * @brief		Receives an item and waits the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		The item of the ring
+ *
+ * @details		Reads an item from the ring. If the ring is empty, the task
+ * 				blocks on a task notification until the producer has written
+ * 				an item or the time expired. A blocked producer is woken with
+ * 				a task notification.
+ * @warning		Only one task may receive from the ring. Like
+ * 				`Queue<T>::receive()` it asserts that an item was received.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline T SpscRing<T, Length, NotifyIndex>::receive(TickType_t ticksToWait)
+{
+	T item; // Create local buffer
+	bool ret = tryReceive(item, ticksToWait);
+
+	assert(ret == true);
+
+	return item;
+}
+
+/**
+ * @brief		Receives an item and waits the default ticks
+ *
+ * @param		void
+ * @return		The item of the ring
+ *
+ * @details		Reads an item from the ring and waits the default amount of
+ * 				time. The default value is `portMAX_DELAY`, so it waits the
+ * 				maximum of time.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline T SpscRing<T, Length, NotifyIndex>::receive(void)
+{
+	return SpscRing<T, Length, NotifyIndex>::receive(defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives an item from an ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		The item of the ring
+ *
+ * @details		Reads an item from the ring from an interrupt service routine,
+ * 				it has no delay because it doesn't block. If the ring is
+ * 				empty, a default constructed item is returned.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline T SpscRing<T, Length, NotifyIndex>::receiveFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	T item{}; // Create local buffer
+
+	tryReceiveFromISR(item, higherPriorityTaskWoken);
+
+	return item;
+}
+
+/**
+ * @brief		Receives an item from an ISR
+ *
+ * @param		void
+ * @return		The item of the ring
+ *
+ * @details		Reads an item from the ring from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline T SpscRing<T, Length, NotifyIndex>::receiveFromISR(void)
+{
+	return SpscRing<T, Length, NotifyIndex>::receiveFromISR(NULL);
+}
+
+/**
+ * @brief		Receives an item into a reference and waits the given ticks
+ *
+ * @param		item			Stores the received item
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Reads an item from the ring. If the ring is empty, the task
+ * 				blocks on a task notification until the producer has written
+ * 				an item or the time expired. A blocked producer is woken with
+ * 				a task notification. On a timeout `item` is not changed.
+ * @warning		Only one task may receive from the ring.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::tryReceive(T &item, TickType_t ticksToWait)
+{
+	TimeOut_t timeOut; // Start time of the receive
+	TaskHandle_t producer; // Producer waiting for space
+	bool ret = pop(item);
+
+	if ((ret == false) && (ticksToWait != 0)) {
+		vTaskSetTimeOutState(&timeOut);
+
+		while (ret == false) {
+			waitingConsumer.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			ret = pop(item);
+
+			if (ret == true) {
+				waitingConsumer.store(NULL, std::memory_order_relaxed);
+			} else if (wait(waitingConsumer, &timeOut, &ticksToWait) == false) {
+				ret = pop(item);
+				break;
+			} else {
+				ret = pop(item);
+			}
+		}
+	}
+
+	if (ret == true) {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		producer = waitingProducer.load(std::memory_order_relaxed);
+
+		if (producer != NULL) {
+			xTaskNotifyGiveIndexed(producer, NotifyIndex);
+		}
+	}
+
+	return ret;
+}
+
+/**
+ * @brief		Receives an item into a reference and waits the default ticks
+ *
+ * @param		item			Stores the received item
+ * @return		True if an item was received, false if the time expired
+ *
+ * @details		Reads an item from the ring and waits the default amount of
+ * 				time. The default value is `portMAX_DELAY`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::tryReceive(T &item)
+{
+	return SpscRing<T, Length, NotifyIndex>::tryReceive(item, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives an item into a reference from an ISR
+ *
+ * @param		item						Stores the received item
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if an item was received, false if the ring is empty
+ *
+ * @details		Reads an item from the ring from an interrupt service routine,
+ * 				it has no delay because it doesn't block. A blocked producer
+ * 				is woken with a task notification.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::tryReceiveFromISR(T &item, BaseType_t *higherPriorityTaskWoken)
+{
+	TaskHandle_t producer; // Producer waiting for space
+
+	if (pop(item) == false) {
+		return false;
+	}
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	producer = waitingProducer.load(std::memory_order_relaxed);
+
+	if (producer != NULL) {
+		vTaskNotifyGiveIndexedFromISR(producer, NotifyIndex, higherPriorityTaskWoken);
+	}
+
+	return true;
+}
+
+/**
+ * @brief		Receives an item into a reference from an ISR
+ *
+ * @param		item			Stores the received item
+ * @return		True if an item was received, false if the ring is empty
+ *
+ * @details		Reads an item from the ring from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline bool SpscRing<T, Length, NotifyIndex>::tryReceiveFromISR(T &item)
+{
+	return SpscRing<T, Length, NotifyIndex>::tryReceiveFromISR(item, NULL);
+}
+
+/**
+ * @brief		Return the number of messages stored in the ring
+ *
+ * @param		void
+ * @return		Number of messages stored in the ring
+ *
+ * @details		Returns the difference of head and tail, without any critical
+ * 				section. The value is exact for the consumer and a lower
+ * 				bound for every other caller.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline UBaseType_t SpscRing<T, Length, NotifyIndex>::messagesWaiting(void)
+{
+	return (UBaseType_t) (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+}
+
+/**
+ * @brief		Return the number of messages stored in the ring from ISR
+ *
+ * @param		void
+ * @return		Number of messages stored in the ring
+ *
+ * @details		Same as messagesWaiting(), the ring needs no special ISR
+ * 				version. Exists to be a drop in replacement for `Queue<T>`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline UBaseType_t SpscRing<T, Length, NotifyIndex>::messagesWaitingFromISR(void)
+{
+	return messagesWaiting();
+}
+
+/**
+ * @brief		Return the number of free spaces in the ring
+ *
+ * @param		void
+ * @return		Number of free spaces in the ring
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline UBaseType_t SpscRing<T, Length, NotifyIndex>::spacesAvailable(void)
+{
+	return (UBaseType_t) Length - messagesWaiting();
+}
+
+/**
+ * @brief		Used to set the default max ticks
+ *
+ * @param		newTicksToWait	New value for the `defaultMaxTicksToWait`
+ * @return		void
+ *
+ * @details		Sets the new default ticks used by receive(). The value is
+ * 				initialized to `portMAX_DELAY`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline void SpscRing<T, Length, NotifyIndex>::setDefaultMaxTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMaxTicksToWait = newTicksToWait;
+}
+
+/**
+ * @brief		Used to set the default min ticks
+ *
+ * @param		newTicksToWait	New value for the `defaultMinTicksToWait`
+ * @return		void
+ *
+ * @details		Sets the new default ticks used by sendToBack(). The value is
+ * 				initialized to `0`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Length, UBaseType_t NotifyIndex>
+inline void SpscRing<T, Length, NotifyIndex>::setDefaultMinTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMinTicksToWait = newTicksToWait;
+}
+
+/****************************************************************************/
+/* End Header : SPSC Ring Class												*/
+/****************************************************************************/
+#endif /* SPSCRING_HPP_ */
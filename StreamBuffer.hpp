@@ -0,0 +1,534 @@
+#ifndef STREAMBUFFER_HPP_
+#define STREAMBUFFER_HPP_
+/****************************************************************************/
+/*  Header    : Stream Buffer Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : StreamBuffer.hpp											*/
+/*                                                                          */
+/*  @brief	  : FreeRTOS-Stream-Buffer Wrapper class						*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#if (__cplusplus >= 202002L)
+#include <span>
+#endif
+
+#include <FreeRTOS.h>
+#include <stream_buffer.h>
+
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class StreamBuffer : public FreeRTOS
+{
+protected:
+	StreamBufferHandle_t	handle;
+	const size_t			size;
+
+	TickType_t				defaultMaxTicksToWait = portMAX_DELAY;
+	TickType_t				defaultMinTicksToWait = 0;
+
+public:
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	StreamBuffer(size_t bufferSize, size_t triggerLevel);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	StreamBuffer(size_t bufferSize, size_t triggerLevel, uint8_t *storageBuffer, StaticStreamBuffer_t *streamBuffer);
+#endif
+
+	~StreamBuffer(void);
+
+	size_t send(const void *data, size_t length, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	size_t send(const void *data, size_t length, const std::chrono::duration<Rep, Period> timeToWait)	{return send(data, length, convertToTicks(timeToWait));};
+	size_t send(const void *data, size_t length);
+
+	size_t sendFromISR(const void *data, size_t length, BaseType_t *higherPriorityTaskWoken);
+	size_t sendFromISR(const void *data, size_t length);
+
+	size_t receive(void *buffer, size_t length, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	size_t receive(void *buffer, size_t length, const std::chrono::duration<Rep, Period> timeToWait)	{return receive(buffer, length, convertToTicks(timeToWait));};
+	size_t receive(void *buffer, size_t length);
+
+	size_t receiveFromISR(void *buffer, size_t length, BaseType_t *higherPriorityTaskWoken);
+	size_t receiveFromISR(void *buffer, size_t length);
+
+#if (__cplusplus >= 202002L)
+	size_t send(std::span<const uint8_t> data, TickType_t ticksToWait)		{return send(data.data(), data.size(), ticksToWait);};
+	template <typename Rep, typename Period>
+	size_t send(std::span<const uint8_t> data, const std::chrono::duration<Rep, Period> timeToWait)	{return send(data.data(), data.size(), convertToTicks(timeToWait));};
+	size_t send(std::span<const uint8_t> data)								{return send(data.data(), data.size());};
+
+	size_t sendFromISR(std::span<const uint8_t> data, BaseType_t *higherPriorityTaskWoken)	{return sendFromISR(data.data(), data.size(), higherPriorityTaskWoken);};
+	size_t sendFromISR(std::span<const uint8_t> data)						{return sendFromISR(data.data(), data.size());};
+
+	size_t receive(std::span<uint8_t> buffer, TickType_t ticksToWait)		{return receive(buffer.data(), buffer.size(), ticksToWait);};
+	template <typename Rep, typename Period>
+	size_t receive(std::span<uint8_t> buffer, const std::chrono::duration<Rep, Period> timeToWait)	{return receive(buffer.data(), buffer.size(), convertToTicks(timeToWait));};
+	size_t receive(std::span<uint8_t> buffer)								{return receive(buffer.data(), buffer.size());};
+
+	size_t receiveFromISR(std::span<uint8_t> buffer, BaseType_t *higherPriorityTaskWoken)	{return receiveFromISR(buffer.data(), buffer.size(), higherPriorityTaskWoken);};
+	size_t receiveFromISR(std::span<uint8_t> buffer)						{return receiveFromISR(buffer.data(), buffer.size());};
+#endif
+
+	bool reset(void);
+
+	bool setTriggerLevel(size_t triggerLevel);
+
+	size_t getSize(void)													{return size;};
+
+	size_t bytesAvailable(void);
+
+	size_t spacesAvailable(void);
+
+	bool isEmpty(void);
+
+	bool isFull(void);
+
+	void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
+
+	void setDefaultMinTicksToWait(TickType_t newTicksToWait);
+	template <typename Rep, typename Period>
+	void setDefaultMinTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMinTicksToWait(convertToTicks(newTimeToWait));};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <size_t Size, size_t TriggerLevel = 1>
+class StreamBufferStatic : public StreamBuffer
+{
+	static_assert((TriggerLevel >= 1) && (TriggerLevel <= Size), "TriggerLevel must be between 1 and Size");
+
+protected:
+	uint8_t					storageBuffer[Size + 1];
+	StaticStreamBuffer_t	streamBuffer;
+
+public:
+	StreamBufferStatic(void);
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor
+ *
+ * @param		bufferSize		Total number of bytes the stream buffer can hold
+ * @param		triggerLevel	Number of bytes that must be in the buffer
+ * 								before a blocked receiver is unblocked
+ *
+ * @details		Constructs a new stream buffer object with the FreeRTOS API
+ * 				function xStreamBufferCreate().
+ * @see			https://www.freertos.org/xStreamBufferCreate.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline StreamBuffer::StreamBuffer(size_t bufferSize, size_t triggerLevel): size(bufferSize)
+{
+	handle = xStreamBufferCreate(size, triggerLevel);
+
+	assert(handle != NULL);
+};
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		bufferSize		Total number of bytes the stream buffer can hold
+ * @param		triggerLevel	Number of bytes that must be in the buffer
+ * 								before a blocked receiver is unblocked
+ * @param		storageBuffer	Array of at least `bufferSize + 1` bytes
+ * @param		streamBuffer	Used to hold the stream buffer's data structure
+ *
+ * @details		Constructs a new stream buffer object with the FreeRTOS API
+ * 				function xStreamBufferCreateStatic(). No memory is allocated
+ * 				from the FreeRTOS heap. Unlike the dynamic creation FreeRTOS
+ * 				doesn't add the byte to tell a full from an empty buffer, so
+ * 				`bufferSize + 1` is passed and `bufferSize` bytes are usable.
+ * @see			https://www.freertos.org/xStreamBufferCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline StreamBuffer::StreamBuffer(size_t bufferSize, size_t triggerLevel, uint8_t *storageBuffer, StaticStreamBuffer_t *streamBuffer): size(bufferSize)
+{
+	handle = xStreamBufferCreateStatic(size + 1, triggerLevel, storageBuffer, streamBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor static stream buffer
+ *
+ * @param		void
+ *
+ * @details		Constructs a new stream buffer object of `Size` bytes, the
+ * 				storage and the stream buffer structure are members of the
+ * 				object. FreeRTOS needs one byte more than `Size` to tell a
+ * 				full from an empty buffer.
+ * @see			https://www.freertos.org/xStreamBufferCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Size, size_t TriggerLevel>
+inline StreamBufferStatic<Size, TriggerLevel>::StreamBufferStatic(void): StreamBuffer(Size, TriggerLevel, storageBuffer, &streamBuffer)
+{
+};
+#endif
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Deletes the stream buffer with the FreeRTOS API function
+ * 				vStreamBufferDelete().
+ * @see			https://www.freertos.org/vStreamBufferDelete.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline StreamBuffer::~StreamBuffer(void)
+{
+	vStreamBufferDelete(handle);
+};
+
+/**
+ * @brief		Sends bytes to the stream buffer
+ *
+ * @param		data			Pointer to the bytes to send
+ * @param		length			Number of bytes to send
+ * @param		ticksToWait		Ticks to wait for enough space
+ * @return		Number of bytes written, can be less than `length` if the
+ * 				time expired
+ *
+ * @details		Copies the bytes with the FreeRTOS API function
+ * 				xStreamBufferSend(). A stream buffer expects exactly one
+ * 				writer and one reader, multiple writers must use a mutex.
+ * @see			https://www.freertos.org/xStreamBufferSend.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::send(const void *data, size_t length, TickType_t ticksToWait)
+{
+	size_t ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, streamBufferSend);
+	ret = xStreamBufferSend(handle, data, length, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, streamBufferSend, (ret == length));
+
+	return ret;
+}
+
+/**
+ * @brief		Sends bytes to the stream buffer with default ticks
+ *
+ * @param		data			Pointer to the bytes to send
+ * @param		length			Number of bytes to send
+ * @return		Number of bytes written
+ *
+ * @details		Sets the ticksToWait to defaultMinTicksToWait. By default this
+ * 				is 0, so only the bytes that fit are written.
+ * @see			https://www.freertos.org/xStreamBufferSend.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::send(const void *data, size_t length)
+{
+	return StreamBuffer::send(data, length, defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Sends bytes to the stream buffer from ISR
+ *
+ * @param		data						Pointer to the bytes to send
+ * @param		length						Number of bytes to send
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Number of bytes written
+ *
+ * @details		If the written bytes reach the trigger level and unblock a
+ * 				task with a higher priority than the interrupted one,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE and a context
+ * 				switch should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object.
+ * @see			https://www.freertos.org/xStreamBufferSendFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::sendFromISR(const void *data, size_t length, BaseType_t *higherPriorityTaskWoken)
+{
+	return xStreamBufferSendFromISR(handle, data, length, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Sends bytes to the stream buffer from ISR
+ *
+ * @param		data			Pointer to the bytes to send
+ * @param		length			Number of bytes to send
+ * @return		Number of bytes written
+ *
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xStreamBufferSendFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::sendFromISR(const void *data, size_t length)
+{
+	return StreamBuffer::sendFromISR(data, length, NULL);
+}
+
+/**
+ * @brief		Receives bytes from the stream buffer
+ *
+ * @param		buffer			Buffer for the received bytes
+ * @param		length			Maximum number of bytes to receive
+ * @param		ticksToWait		Ticks to wait for the trigger level
+ * @return		Number of bytes read, 0 if the time expired
+ *
+ * @details		Blocks until at least the trigger level of bytes is available
+ * 				or the time expired, then copies as many bytes as available,
+ * 				up to `length`, with the FreeRTOS API function
+ * 				xStreamBufferReceive().
+ * @see			https://www.freertos.org/xStreamBufferReceive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::receive(void *buffer, size_t length, TickType_t ticksToWait)
+{
+	size_t ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, streamBufferReceive);
+	ret = xStreamBufferReceive(handle, buffer, length, ticksToWait);
+	WRAPPER_TRACE_EXIT(handle, streamBufferReceive, (ret != 0));
+
+	return ret;
+}
+
+/**
+ * @brief		Receives bytes from the stream buffer with default ticks
+ *
+ * @param		buffer			Buffer for the received bytes
+ * @param		length			Maximum number of bytes to receive
+ * @return		Number of bytes read, 0 if the time expired
+ *
+ * @details		Sets the ticksToWait to defaultMaxTicksToWait. By default this
+ * 				is portMAX_DELAY.
+ * @see			https://www.freertos.org/xStreamBufferReceive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::receive(void *buffer, size_t length)
+{
+	return StreamBuffer::receive(buffer, length, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives bytes from the stream buffer from ISR
+ *
+ * @param		buffer						Buffer for the received bytes
+ * @param		length						Maximum number of bytes to receive
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Number of bytes read
+ *
+ * @details		If reading makes space for a blocked writer with a higher
+ * 				priority than the interrupted task, `higherPriorityTaskWoken`
+ * 				is set to pdTRUE.
+ * @see			https://www.freertos.org/xStreamBufferReceiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::receiveFromISR(void *buffer, size_t length, BaseType_t *higherPriorityTaskWoken)
+{
+	return xStreamBufferReceiveFromISR(handle, buffer, length, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Receives bytes from the stream buffer from ISR
+ *
+ * @param		buffer			Buffer for the received bytes
+ * @param		length			Maximum number of bytes to receive
+ * @return		Number of bytes read
+ *
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. A woken task has to wait for
+ * 				the next tick to run, use the overloaded method to avoid that.
+ * @see			https://www.freertos.org/xStreamBufferReceiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::receiveFromISR(void *buffer, size_t length)
+{
+	return StreamBuffer::receiveFromISR(buffer, length, NULL);
+}
+
+/**
+ * @brief		Resets the stream buffer to empty
+ *
+ * @param		void
+ * @return		True if it was successful, false if a task is blocked on it
+ *
+ * @see			https://www.freertos.org/xStreamBufferReset.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool StreamBuffer::reset(void)
+{
+	return (xStreamBufferReset(handle) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Sets the trigger level
+ *
+ * @param		triggerLevel	Number of bytes that must be in the buffer
+ * 								before a blocked receiver is unblocked
+ * @return		True if it was successful, false if it's larger than the buffer
+ *
+ * @details		A trigger level of 1 unblocks the receiver with every byte, a
+ * 				higher level collects e.g. a whole packet before the receiver
+ * 				runs, which saves context switches.
+ * @see			https://www.freertos.org/xStreamBufferSetTriggerLevel.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool StreamBuffer::setTriggerLevel(size_t triggerLevel)
+{
+	return (xStreamBufferSetTriggerLevel(handle, triggerLevel) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Gets the number of bytes in the stream buffer
+ *
+ * @param		void
+ * @return		Number of bytes that can be read
+ *
+ * @see			https://www.freertos.org/xStreamBufferBytesAvailable.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::bytesAvailable(void)
+{
+	return xStreamBufferBytesAvailable(handle);
+}
+
+/**
+ * @brief		Gets the free space of the stream buffer
+ *
+ * @param		void
+ * @return		Number of bytes that can be written
+ *
+ * @see			https://www.freertos.org/xStreamBufferSpacesAvailable.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline size_t StreamBuffer::spacesAvailable(void)
+{
+	return xStreamBufferSpacesAvailable(handle);
+}
+
+/**
+ * @brief		Checks if the stream buffer is empty
+ *
+ * @param		void
+ * @return		True if it's empty, false otherwise
+ *
+ * @see			https://www.freertos.org/xStreamBufferIsEmpty.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool StreamBuffer::isEmpty(void)
+{
+	return (xStreamBufferIsEmpty(handle) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Checks if the stream buffer is full
+ *
+ * @param		void
+ * @return		True if it's full, false otherwise
+ *
+ * @see			https://www.freertos.org/xStreamBufferIsFull.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool StreamBuffer::isFull(void)
+{
+	return (xStreamBufferIsFull(handle) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Sets the default maximum ticks to wait
+ *
+ * @param		newTicksToWait	Ticks to wait of receive() without a time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void StreamBuffer::setDefaultMaxTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMaxTicksToWait = newTicksToWait;
+}
+
+/**
+ * @brief		Sets the default minimum ticks to wait
+ *
+ * @param		newTicksToWait	Ticks to wait of send() without a time
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void StreamBuffer::setDefaultMinTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMinTicksToWait = newTicksToWait;
+}
+
+/****************************************************************************/
+/* End Header : Stream Buffer Class											*/
+/****************************************************************************/
+#endif /* STREAMBUFFER_HPP_ */
@@ -0,0 +1,261 @@
+#ifndef SYSTEM_HPP_
+#define SYSTEM_HPP_
+/****************************************************************************/
+/*  Header    : System Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : System.hpp													*/
+/*                                                                          */
+/*  @brief	  : Compile time description of all tasks, queues and timers,	*/
+/*				created in one pass before the scheduler starts				*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <tuple>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <timers.h>
+
+#include "FreeRTOS.hpp"
+#include "Queue.hpp"
+#include "Task.hpp"
+#include "Timer.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename Object>
+class SystemObject
+{
+public:
+	using ObjectType = Object;
+
+	static constexpr size_t ramSize = sizeof(Object);
+
+protected:
+	alignas(Object) uint8_t			storage[sizeof(Object)];
+	Object							*object = NULL;
+
+public:
+	Object &get(void);
+
+	bool isCreated(void)													{return (object != NULL) ? true : false;};
+};
+
+/* Class definition            */
+template <const char *Name, TaskFunction_t Function, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t Priority>
+class SystemTask : public SystemObject<TaskStatic<StackDepth>>
+{
+	static_assert(Priority < configMAX_PRIORITIES, "Priority must be lower than configMAX_PRIORITIES");
+	static_assert(StackDepth >= configMINIMAL_STACK_SIZE, "StackDepth must be at least configMINIMAL_STACK_SIZE");
+
+public:
+	void create(void);
+};
+
+/* Class definition            */
+template <const char *Name, typename T, UBaseType_t Length>
+class SystemQueue : public SystemObject<QueueStatic<T, Length>>
+{
+	static_assert(Length != 0, "Length must not be 0");
+
+public:
+	void create(void);
+};
+
+/* Class definition            */
+template <const char *Name, TimerCallbackFunction_t Callback, TickType_t Period, bool AutoReload>
+class SystemTimer : public SystemObject<TimerStatic>
+{
+	static_assert(Period != 0, "Period must not be 0");
+	static_assert(configUSE_TIMERS == 1, "configUSE_TIMERS must be 1");
+
+public:
+	void create(void);
+};
+
+/* Class definition            */
+template <size_t RamBudget, typename... Definitions>
+class System : public FreeRTOS
+{
+public:
+	static constexpr size_t ramSize = (static_cast<size_t>(0) + ... + Definitions::ramSize);
+
+	static_assert(ramSize <= RamBudget, "The objects of the system need more RAM than RamBudget");
+
+protected:
+	std::tuple<Definitions...>		definitions;
+	bool							created = false;
+
+public:
+	System(void) {};
+
+	System(const System &) = delete;
+	System &operator=(const System &) = delete;
+
+	void create(void);
+
+	void start(void);
+
+	template <typename Definition>
+	typename Definition::ObjectType &get(void)								{return std::get<Definition>(definitions).get();};
+};
+
+/**
+ * @brief		Gets the object
+ *
+ * @param		void
+ * @return		Reference to the created object
+ *
+ * @warning		Asserts if the object is not yet created.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Object>
+inline Object &SystemObject<Object>::get(void)
+{
+	assert(object != NULL);
+
+	return *object;
+}
+
+/**
+ * @brief		Creates the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Constructs a TaskStatic in the storage of the definition, the
+ * 				stack and the TCB are part of it. No parameter is passed to
+ * 				`Function`.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <const char *Name, TaskFunction_t Function, configSTACK_DEPTH_TYPE StackDepth, UBaseType_t Priority>
+inline void SystemTask<Name, Function, StackDepth, Priority>::create(void)
+{
+	this->object = new (this->storage) TaskStatic<StackDepth>(Function, Name, NULL, Priority);
+}
+
+/**
+ * @brief		Creates the queue
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Constructs a QueueStatic in the storage of the definition and
+ * 				adds it to the registry with `Name`.
+ * @see			https://www.freertos.org/xQueueCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <const char *Name, typename T, UBaseType_t Length>
+inline void SystemQueue<Name, T, Length>::create(void)
+{
+	this->object = new (this->storage) QueueStatic<T, Length>(true, Name);
+}
+
+/**
+ * @brief		Creates the timer
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Constructs a TimerStatic in the storage of the definition. The
+ * 				timer is dormant until it's started, which can be done before
+ * 				the scheduler runs.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <const char *Name, TimerCallbackFunction_t Callback, TickType_t Period, bool AutoReload>
+inline void SystemTimer<Name, Callback, Period, AutoReload>::create(void)
+{
+	this->object = new (this->storage) TimerStatic(Name, Period, AutoReload, Callback);
+}
+
+/**
+ * @brief		Creates all objects of the system
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Creates the tasks, queues and timers in the order of
+ * 				`Definitions`, in one pass and without heap. All storage is
+ * 				part of the System object, so a global System is in .bss and
+ * 				its size is known at link time. The total size is checked
+ * 				against `RamBudget`, the priorities and stack depths of the
+ * 				tasks are checked at compile time, e.g.
+ * 				`inline constexpr char controlName[] = "control";`
+ * 				`System<16384, SystemTask<controlName, &control, 512, 3>, SystemQueue<rxName, Frame, 8>> app;`
+ * 				Calling it a second time has no effect.
+ * @warning		Call it before the scheduler starts, a task could run before
+ * 				the queues it uses are created otherwise.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t RamBudget, typename... Definitions>
+inline void System<RamBudget, Definitions...>::create(void)
+{
+	if (created == true) {
+		return;
+	}
+
+	std::apply([](Definitions &... definition) {(definition.create(), ...);}, definitions);
+
+	created = true;
+}
+
+/**
+ * @brief		Creates all objects and starts the scheduler
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Calls create() and FreeRTOS::startScheduler(), so it only
+ * 				returns if the scheduler could not be started.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t RamBudget, typename... Definitions>
+inline void System<RamBudget, Definitions...>::start(void)
+{
+	create();
+
+	startScheduler();
+}
+#endif
+
+/****************************************************************************/
+/* End Header : System Class												*/
+/****************************************************************************/
+#endif /* SYSTEM_HPP_ */
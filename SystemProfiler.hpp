@@ -0,0 +1,325 @@
+#ifndef SYSTEMPROFILER_HPP_
+#define SYSTEMPROFILER_HPP_
+/****************************************************************************/
+/*  Header    : System Profiler Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : SystemProfiler.hpp											*/
+/*                                                                          */
+/*  @brief	  : Heap free CPU load of all tasks from uxTaskGetSystemState()	*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- 14.10.2026	NZ	Add: getCoreLoad() for SMP				*/
+/*				- 14.10.2026	NZ	Fix: Negative load if the idle task		*/
+/*									isn't in the snapshot					*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+/* Class definition            */
+template <UBaseType_t MaxTasks>
+class SystemProfiler : public FreeRTOS
+{
+public:
+	using RunTimeCounter = decltype(TaskStatus_t::ulRunTimeCounter);
+
+protected:
+	struct PreviousRunTime
+	{
+		TaskHandle_t				handle;
+		RunTimeCounter				runTimeCounter;
+	};
+
+	TaskStatus_t					status[MaxTasks];
+	RunTimeCounter					runTimeDelta[MaxTasks];
+	PreviousRunTime					previous[MaxTasks];
+
+	UBaseType_t						taskCount = 0;
+	UBaseType_t						previousTaskCount = 0;
+
+	RunTimeCounter					totalRunTime = 0;
+	RunTimeCounter					elapsedRunTime = 0;
+
+	float getIdleLoad(TaskHandle_t idleTask);
+
+public:
+	SystemProfiler(void) {};
+
+	bool update(void);
+
+	UBaseType_t getTaskCount(void)											{return taskCount;};
+
+	const TaskStatus_t &getStatus(UBaseType_t index);
+
+	RunTimeCounter getRunTimeDelta(UBaseType_t index);
+
+	RunTimeCounter getElapsedRunTime(void)									{return elapsedRunTime;};
+
+	float getLoad(UBaseType_t index);
+
+#if (INCLUDE_xTaskGetIdleTaskHandle == 1)
+	float getTotalLoad(void);
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+	float getCoreLoad(BaseType_t coreId);
+#endif
+#endif
+};
+
+/**
+ * @brief		Takes a snapshot of all tasks
+ *
+ * @param		void
+ * @return		True if all tasks fit into the array, false otherwise
+ *
+ * @details		Fills the preallocated array with one call of
+ * 				uxTaskGetSystemState(), without heap and without formatting
+ * 				strings like vTaskGetRunTimeStats(). The run time of every task
+ * 				is compared with the last snapshot, matched by the task handle,
+ * 				so the results of getLoad() are for the interval between two
+ * 				calls. The first call measures since the scheduler started.
+ * 				The scheduler is suspended while the lists are copied, which
+ * 				takes time linear to the number of tasks, but no task is
+ * 				blocked or delayed otherwise.
+ * @warning		If there are more than `MaxTasks` tasks, FreeRTOS copies
+ * 				nothing and false is returned, the last results stay valid.
+ * @see			https://www.freertos.org/uxTaskGetSystemState.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline bool SystemProfiler<MaxTasks>::update(void)
+{
+	RunTimeCounter newTotalRunTime = 0; // Run time counter at the snapshot
+	UBaseType_t count; // Number of tasks copied
+
+	for (UBaseType_t i = 0; i < taskCount; i++) {
+		previous[i].handle = status[i].xHandle;
+		previous[i].runTimeCounter = status[i].ulRunTimeCounter;
+	}
+
+	previousTaskCount = taskCount;
+
+	count = uxTaskGetSystemState(status, MaxTasks, &newTotalRunTime);
+
+	if (count == 0) {
+		return false;
+	}
+
+	taskCount = count;
+	elapsedRunTime = newTotalRunTime - totalRunTime;
+	totalRunTime = newTotalRunTime;
+
+	for (UBaseType_t i = 0; i < taskCount; i++) {
+		runTimeDelta[i] = status[i].ulRunTimeCounter;
+
+		for (UBaseType_t j = 0; j < previousTaskCount; j++) {
+			if (previous[j].handle == status[i].xHandle) {
+				runTimeDelta[i] = status[i].ulRunTimeCounter - previous[j].runTimeCounter;
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief		Gets the status of a task of the last snapshot
+ *
+ * @param		index			Index of the task, lower than getTaskCount()
+ * @return		Status of the task, as filled in by uxTaskGetSystemState()
+ *
+ * @details		Includes the handle, name, priority, state, stack high water
+ * 				mark and the total run time of the task.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline const TaskStatus_t &SystemProfiler<MaxTasks>::getStatus(UBaseType_t index)
+{
+	assert(index < taskCount);
+
+	return status[index];
+}
+
+/**
+ * @brief		Gets the run time of a task since the last snapshot
+ *
+ * @param		index			Index of the task, lower than getTaskCount()
+ * @return		Run time in units of the run time counter
+ *
+ * @details		Tasks that are new since the last snapshot report their run
+ * 				time since their creation.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline typename SystemProfiler<MaxTasks>::RunTimeCounter SystemProfiler<MaxTasks>::getRunTimeDelta(UBaseType_t index)
+{
+	assert(index < taskCount);
+
+	return runTimeDelta[index];
+}
+
+/**
+ * @brief		Gets the CPU load of a task
+ *
+ * @param		index			Index of the task, lower than getTaskCount()
+ * @return		Load in percent of the interval between the last two snapshots
+ *
+ * @details		Relation between the run time of the task and the elapsed run
+ * 				time counter between the last two calls of update(). With more
+ * 				than one core the load is relative to one core, so the loads
+ * 				of all tasks add up to configNUMBER_OF_CORES times 100 %.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline float SystemProfiler<MaxTasks>::getLoad(UBaseType_t index)
+{
+	assert(index < taskCount);
+
+	if (elapsedRunTime == 0) {
+		return 0.0f;
+	}
+
+	return (float) runTimeDelta[index] * 100.0f / (float) elapsedRunTime;
+}
+
+/**
+ * @brief		Gets the load of an idle task
+ *
+ * @param		idleTask		Handle of the idle task
+ * @return		Load in percent of the interval between the last two snapshots,
+ * 				-1 if the task isn't in the snapshot
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: -1 instead of 100 % if not found
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline float SystemProfiler<MaxTasks>::getIdleLoad(TaskHandle_t idleTask)
+{
+	for (UBaseType_t i = 0; i < taskCount; i++) {
+		if (status[i].xHandle == idleTask) {
+			return getLoad(i);
+		}
+	}
+
+	return -1.0f;
+}
+
+#if (INCLUDE_xTaskGetIdleTaskHandle == 1)
+/**
+ * @brief		Gets the total CPU load
+ *
+ * @param		void
+ * @return		Load in percent of the interval between the last two snapshots,
+ * 				negative if an idle task isn't in the snapshot
+ *
+ * @details		Calculated as 100 % minus the load of the idle task, so the
+ * 				time of ISRs and the kernel is included in the load. With more
+ * 				than one core it's the average of getCoreLoad() of all cores.
+ * 				An idle task is missing if update() returned false because
+ * 				MaxTasks is too small, the result is invalid then, not 0 %.
+ * @see			https://www.freertos.org/a00021.html#xTaskGetIdleTaskHandle
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Average of all cores for SMP
+ * 				- 14.10.2026	NZ	Fix: Negative if an idle task is missing
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline float SystemProfiler<MaxTasks>::getTotalLoad(void)
+{
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+	float load = 0.0f; // Sum of the core loads
+
+	for (BaseType_t core = 0; core < configNUMBER_OF_CORES; core++) {
+		float coreLoad = getCoreLoad(core); // Load of this core
+
+		if (coreLoad < 0.0f) {
+			return -1.0f;
+		}
+		load += coreLoad;
+	}
+
+	return load / (float) configNUMBER_OF_CORES;
+#else
+	float idleLoad = getIdleLoad(xTaskGetIdleTaskHandle()); // Load of the idle task
+
+	if (idleLoad < 0.0f) {
+		return -1.0f;
+	}
+
+	return 100.0f - idleLoad;
+#endif
+}
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+/**
+ * @brief		Gets the CPU load of one core
+ *
+ * @param		coreId			Index of the core, lower than configNUMBER_OF_CORES
+ * @return		Load in percent of the interval between the last two snapshots,
+ * 				-1 if the idle task of the core isn't in the snapshot
+ *
+ * @details		Calculated as 100 % minus the load of the idle task of the
+ * 				core. Every core has its own idle task, which only runs on it,
+ * 				so an imbalance between the cores shows up even if the average
+ * 				of getTotalLoad() looks fine.
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/03-Task-utilities/00-Task-utilities#xtaskgetidletaskhandleforcore
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: -1 if the idle task is missing
+ ****************************************************************************/
+template <UBaseType_t MaxTasks>
+inline float SystemProfiler<MaxTasks>::getCoreLoad(BaseType_t coreId)
+{
+	assert((coreId >= 0) && (coreId < configNUMBER_OF_CORES));
+
+	float idleLoad = getIdleLoad(xTaskGetIdleTaskHandleForCore(coreId)); // Load of the idle task
+
+	if (idleLoad < 0.0f) {
+		return -1.0f;
+	}
+
+	return 100.0f - idleLoad;
+}
+#endif
+#endif
+#endif
+
+/****************************************************************************/
+/* End Header : System Profiler Class										*/
+/****************************************************************************/
+#endif /* SYSTEMPROFILER_HPP_ */
@@ -18,16 +18,36 @@
 /*									and add method headers					*/
 /*				- 21.04.2023	NZ	Mod: Combined .cpp and .hpp and made the*/
 /*									methods inline							*/
+/*				- 14.10.2026	NZ	Add: Static allocation, TaskStatic class*/
+/*				- 14.10.2026	NZ	Mod: Name as std::string_view, no name	*/
+/*									member anymore (FreeRTOS holds a copy)	*/
+/*				- 14.10.2026	NZ	Add: resumeFromISR() with the			*/
+/*									pxHigherPriorityTaskWoken parameter		*/
+/*				- 14.10.2026	NZ	Add: Task notification methods			*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Fix: delayUntil() seeds the wake time	*/
+/*									and returns the result of				*/
+/*									xTaskDelayUntil()						*/
+/*				- 14.10.2026	NZ	Add: getStackHighWaterMark(), registry	*/
+/*									of all tasks and getStackReport()		*/
+/*				- 14.10.2026	NZ	Fix: No uninitialized freeStackSpace	*/
+/*									flag in getInfo() anymore				*/
+/*				- 14.10.2026	NZ	Add: Optional trace of the blocking calls*/
+/*				- 14.10.2026	NZ	Add: Core affinity and preemption		*/
+/*									control for SMP							*/
+/*				- 14.10.2026	NZ	Add: Deferred creation of static tasks	*/
+/*				- 14.10.2026	NZ	Fix: Own wake time member for delayUntil()*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
+/*				- 14.10.2026	NZ	Add: deleteTask(), getStackReport() scans*/
+/*									with the scheduler running				*/
 /*                                                                          */
 /*  @todo	  :	- Add this functions from API								*/
-/*					- xTaskCreateStatic()									*/
 /*					- xTaskCreateRestrictedStatic()							*/
-/*					- xTaskDelayUntil()										*/
 /*					- xTaskAbortDelay()										*/
 /*					- uxTaskGetSystemState()								*/
 /*					- xTaskGetApplicationTaskTag()							*/
 /*					- xTaskGetCurrentTaskHandle()							*/
-/*					- uxTaskGetStackHighWaterMark()							*/
 /*					- pcTaskGetName()										*/
 /*				- Test the whole class extensively							*/
 /*																			*/
@@ -36,11 +56,15 @@
 /****************************************************************************/
 
 /* imports */
-#include <string>
+#include <chrono>
+#include <string_view>
 
 #include <FreeRTOS.h>
 #include <task.h>
 
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -52,51 +76,132 @@ class Task : public FreeRTOS
 {
 protected:
 	const TaskFunction_t			functionPointer;
-	const std::string				name;
 	const configSTACK_DEPTH_TYPE	stackSize;
 	const void						*parameters;
 	TaskHandle_t					handle = NULL;
 
-	TickType_t						currentTickCount;
+	TickType_t						currentTickCount = 0;
+	TickType_t						wakeTime = 0;
+	bool							wakeTimeValid = false;
 
 	TaskStatus_t					status;
-	BaseType_t						freeStackSpace;
+
+	Task							*nextTask = NULL;
+	inline static Task				*firstTask = NULL;
+
+	void addToRegistry(void);
+	void removeFromRegistry(void);
+
+	Task(	TaskFunction_t taskFunction,
+			configSTACK_DEPTH_TYPE taskStackSize,
+			void *taskParameters);
 
 public:
+	struct StackUsage
+	{
+		const char					*name;
+		TaskHandle_t				handle;
+		configSTACK_DEPTH_TYPE		stackSize;
+		configSTACK_DEPTH_TYPE		used;
+		configSTACK_DEPTH_TYPE		recommended;
+	};
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 	Task(	TaskFunction_t taskFunction,
-			std::string taskName,
+			std::string_view taskName,
 			configSTACK_DEPTH_TYPE taskStackSize,
 			void *taskParameters,
             UBaseType_t taskPriority);
 
 	Task(	TaskFunction_t taskFunction,
-			const std::string taskName,
+			std::string_view taskName,
 			configSTACK_DEPTH_TYPE taskStackSize,
 			UBaseType_t taskPriority);
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
+	Task(	TaskFunction_t taskFunction,
+			std::string_view taskName,
+			configSTACK_DEPTH_TYPE taskStackSize,
+			void *taskParameters,
+			UBaseType_t taskPriority,
+			UBaseType_t taskCoreAffinityMask);
+#endif
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	Task(	TaskFunction_t taskFunction,
+			std::string_view taskName,
+			configSTACK_DEPTH_TYPE taskStackSize,
+			void *taskParameters,
+			UBaseType_t taskPriority,
+			StackType_t *stackBuffer,
+			StaticTask_t *taskBuffer);
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
+	Task(	TaskFunction_t taskFunction,
+			std::string_view taskName,
+			configSTACK_DEPTH_TYPE taskStackSize,
+			void *taskParameters,
+			UBaseType_t taskPriority,
+			StackType_t *stackBuffer,
+			StaticTask_t *taskBuffer,
+			UBaseType_t taskCoreAffinityMask);
+#endif
+#endif
+
 	~Task();
 
 	void delay(const TickType_t ticksToDelay);
+	template <typename Rep, typename Period>
+	void delay(const std::chrono::duration<Rep, Period> timeToDelay)							{delay(convertToTicks(timeToDelay));};
 
-	void delayUntil(TickType_t *previousWakeTime, const TickType_t ticksToIncrement);
-	void delayUntil(const TickType_t ticksToIncrement);
+	bool delayUntil(TickType_t *previousWakeTime, const TickType_t ticksToIncrement);
+	bool delayUntil(const TickType_t ticksToIncrement);
+	template <typename Rep, typename Period>
+	bool delayUntil(TickType_t *previousWakeTime, const std::chrono::duration<Rep, Period> timeToIncrement)	{return delayUntil(previousWakeTime, convertToTicks(timeToIncrement));};
+	template <typename Rep, typename Period>
+	bool delayUntil(const std::chrono::duration<Rep, Period> timeToIncrement)					{return delayUntil(convertToTicks(timeToIncrement));};
 
 	UBaseType_t getPriority(void);
 
 	void setPriority(UBaseType_t newPriority);
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+#if (configUSE_CORE_AFFINITY == 1)
+	void setCoreAffinity(UBaseType_t coreAffinityMask);
+
+	UBaseType_t getCoreAffinity(void);
+#endif
+
+#if (configUSE_TASK_PREEMPTION_DISABLE == 1)
+	void disablePreemption(void);
+
+	void enablePreemption(void);
+#endif
+
+	BaseType_t static getCoreId(void)										{return (BaseType_t) portGET_CORE_ID();};
+#endif
+
 	void suspend(void);
 
 	void resume(void);
 
+	bool resumeFromISR(BaseType_t *higherPriorityTaskWoken);
 	bool resumeFromISR(void);
 
+	void deleteTask(void);
+
 	void yield(void);
 
-	TaskStatus_t getInfo(eTaskState eState);
+	TaskStatus_t getInfo(eTaskState eState, bool getFreeStackSpace = false);
 	TaskStatus_t getInfo(void);
 
-	BaseType_t getFreeStackSpace(void);
+	UBaseType_t getFreeStackSpace(void);
+
+	UBaseType_t getStackHighWaterMark(void);
+
+	UBaseType_t static getStackReport(StackUsage *report, UBaseType_t maxEntries, UBaseType_t marginPercent);
+	UBaseType_t static getStackReport(StackUsage *report, UBaseType_t maxEntries);
 
 	eTaskState getState(void);
 
@@ -106,9 +211,95 @@ public:
 
 	TickType_t updateTickCountFromISR(void);
 
-	std::string getName(void);
+	const char *getName(void);
+
+	bool notify(UBaseType_t indexToNotify, uint32_t value, eNotifyAction action);
+	bool notify(uint32_t value, eNotifyAction action);
+
+	bool notifyFromISR(UBaseType_t indexToNotify, uint32_t value, eNotifyAction action, BaseType_t *higherPriorityTaskWoken);
+	bool notifyFromISR(uint32_t value, eNotifyAction action, BaseType_t *higherPriorityTaskWoken);
+
+	void notifyGive(UBaseType_t indexToNotify);
+	void notifyGive(void);
+
+	void notifyGiveFromISR(UBaseType_t indexToNotify, BaseType_t *higherPriorityTaskWoken);
+	void notifyGiveFromISR(BaseType_t *higherPriorityTaskWoken);
+
+	void notifySetBits(UBaseType_t indexToNotify, uint32_t bitsToSet);
+	void notifySetBits(uint32_t bitsToSet);
+
+	void notifySetBitsFromISR(UBaseType_t indexToNotify, uint32_t bitsToSet, BaseType_t *higherPriorityTaskWoken);
+	void notifySetBitsFromISR(uint32_t bitsToSet, BaseType_t *higherPriorityTaskWoken);
+
+	void notifyOverwrite(UBaseType_t indexToNotify, uint32_t value);
+	void notifyOverwrite(uint32_t value);
+
+	void notifyOverwriteFromISR(UBaseType_t indexToNotify, uint32_t value, BaseType_t *higherPriorityTaskWoken);
+	void notifyOverwriteFromISR(uint32_t value, BaseType_t *higherPriorityTaskWoken);
+
+	bool notifyStateClear(UBaseType_t indexToClear);
+	bool notifyStateClear(void);
+
+	uint32_t notifyValueClear(UBaseType_t indexToClear, uint32_t bitsToClear);
+	uint32_t notifyValueClear(uint32_t bitsToClear);
+
+	uint32_t static notifyTake(UBaseType_t indexToWaitOn, bool clearCountOnExit, TickType_t ticksToWait);
+	uint32_t static notifyTake(bool clearCountOnExit, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	uint32_t static notifyTake(UBaseType_t indexToWaitOn, bool clearCountOnExit, const std::chrono::duration<Rep, Period> timeToWait)	{return notifyTake(indexToWaitOn, clearCountOnExit, convertToTicks(timeToWait));};
+	template <typename Rep, typename Period>
+	uint32_t static notifyTake(bool clearCountOnExit, const std::chrono::duration<Rep, Period> timeToWait)	{return notifyTake(clearCountOnExit, convertToTicks(timeToWait));};
+
+	bool static notifyWait(UBaseType_t indexToWaitOn, uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, TickType_t ticksToWait);
+	bool static notifyWait(uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	bool static notifyWait(UBaseType_t indexToWaitOn, uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, const std::chrono::duration<Rep, Period> timeToWait)	{return notifyWait(indexToWaitOn, bitsToClearOnEntry, bitsToClearOnExit, notificationValue, convertToTicks(timeToWait));};
+	template <typename Rep, typename Period>
+	bool static notifyWait(uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, const std::chrono::duration<Rep, Period> timeToWait)	{return notifyWait(bitsToClearOnEntry, bitsToClearOnExit, notificationValue, convertToTicks(timeToWait));};
+
+	uint32_t static waitFor(UBaseType_t indexToWaitOn, uint32_t bitsToWaitFor, TickType_t ticksToWait);
+	uint32_t static waitFor(uint32_t bitsToWaitFor, TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	uint32_t static waitFor(UBaseType_t indexToWaitOn, uint32_t bitsToWaitFor, const std::chrono::duration<Rep, Period> timeToWait)	{return waitFor(indexToWaitOn, bitsToWaitFor, convertToTicks(timeToWait));};
+	template <typename Rep, typename Period>
+	uint32_t static waitFor(uint32_t bitsToWaitFor, const std::chrono::duration<Rep, Period> timeToWait)	{return waitFor(bitsToWaitFor, convertToTicks(timeToWait));};
+};
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <configSTACK_DEPTH_TYPE StackDepth>
+class TaskStatic : public Task
+{
+protected:
+	StackType_t						stackBuffer[StackDepth];
+	StaticTask_t					taskBuffer;
+
+	TaskStatic(	TaskFunction_t taskFunction,
+				void *taskParameters);
+
+	void create(std::string_view taskName, UBaseType_t taskPriority);
+
+public:
+	TaskStatic(	TaskFunction_t taskFunction,
+				std::string_view taskName,
+				void *taskParameters,
+				UBaseType_t taskPriority);
+
+	TaskStatic(	TaskFunction_t taskFunction,
+				std::string_view taskName,
+				UBaseType_t taskPriority);
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
+	TaskStatic(	TaskFunction_t taskFunction,
+				std::string_view taskName,
+				void *taskParameters,
+				UBaseType_t taskPriority,
+				UBaseType_t taskCoreAffinityMask);
+#endif
 };
+#endif
 
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 /**
  * @brief		Constructor
  *
@@ -125,23 +316,29 @@ public:
  *
  * @author		N. Zoller (NZ)
  * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Adds the task to the task registry
  ****************************************************************************/
 inline Task::Task(	TaskFunction_t taskFunction,
-					std::string taskName,
+					std::string_view taskName,
 					configSTACK_DEPTH_TYPE taskStackSize,
 					void *taskParameters,
 					UBaseType_t taskPriority)
 					:	functionPointer(taskFunction),
-						name(taskName),
 						stackSize(taskStackSize),
 						parameters(taskParameters)
 {
 	BaseType_t ret; // Temporary return value
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
 
-	ret = xTaskCreate(functionPointer, (const char * const) name.c_str(),  stackSize, (void *) parameters, taskPriority, &handle);
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
+
+	ret = xTaskCreate(functionPointer, nameBuffer,  stackSize, (void *) parameters, taskPriority, &handle);
 
 	assert(ret == pdPASS);
 	assert(handle != NULL);
+
+	addToRegistry();
 }
 
 /**
@@ -159,279 +356,912 @@ inline Task::Task(	TaskFunction_t taskFunction,
  *
  * @author		N. Zoller (NZ)
  * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Adds the task to the task registry
  ****************************************************************************/
 inline Task::Task(	TaskFunction_t taskFunction,
-					std::string taskName,
+					std::string_view taskName,
 					configSTACK_DEPTH_TYPE taskStackSize,
 					UBaseType_t taskPriority)
 					:	functionPointer(taskFunction),
-						name(taskName),
 						stackSize(taskStackSize)
 {
 	BaseType_t ret; // Temporary return value
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
+
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
 
-	ret = xTaskCreate(functionPointer, (const char * const) name.c_str(),  stackSize, (void *) 0, taskPriority, &handle);
+	ret = xTaskCreate(functionPointer, nameBuffer,  stackSize, (void *) 0, taskPriority, &handle);
 
 	assert(ret == pdPASS);
 	assert(handle != NULL);
+
+	addToRegistry();
 }
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
 /**
- * @brief		Destructor
+ * @brief		Constructor, with core affinity
  *
- * @param		void
+ * @param		taskFunction			Pointer to the task entry function
+ * @param		taskName				A descriptive name for the task
+ * @param		taskStackSize			The number of words (not bytes!) to allocate for use as the task's stack
+ * @param		taskParameters			A value that is passed as the paramater to the created task
+ * @param		taskPriority			The priority at which the created task will execute
+ * @param		taskCoreAffinityMask	Bit `n` set allows the task to run on core `n`
  *
- * @details		Deletes a queue object with the FreeRTOS API function
- * 				vTaskDelete().
- * @see			https://www.freertos.org/a00126.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateAffinitySet(). The task is pinned from the start,
+ * 				so it never runs on another core, e.g. `0b01` for the control
+ * 				loop on core 0.
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/03-xTaskCreateAffinitySet
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline Task::~Task(void)
+inline Task::Task(	TaskFunction_t taskFunction,
+					std::string_view taskName,
+					configSTACK_DEPTH_TYPE taskStackSize,
+					void *taskParameters,
+					UBaseType_t taskPriority,
+					UBaseType_t taskCoreAffinityMask)
+					:	functionPointer(taskFunction),
+						stackSize(taskStackSize),
+						parameters(taskParameters)
 {
-	vTaskDelete(handle);;
-};
+	BaseType_t ret; // Temporary return value
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
 
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
+
+	ret = xTaskCreateAffinitySet(functionPointer, nameBuffer, stackSize, (void *) parameters, taskPriority, taskCoreAffinityMask, &handle);
+
+	assert(ret == pdPASS);
+	assert(handle != NULL);
+
+	addToRegistry();
+}
+#endif
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
 /**
- * @brief		Delay a task
+ * @brief		Constructor, with static memory
  *
- * @param		ticksToDelay	The amount of time, in tick periods, that the calling task should block
- * @return		void
+ * @param		taskFunction	Pointer to the task entry function
+ * @param		taskName		A descriptive name for the task
+ * @param		taskStackSize	The number of words (not bytes!) in the stackBuffer
+ * @param		taskParameters	A value that is passed as the paramater to the created task
+ * @param		taskPriority	The priority at which the created task will execute
+ * @param		stackBuffer		Array of at least taskStackSize words, used as the task's stack
+ * @param		taskBuffer		Used to hold the task's data structure (TCB)
  *
- * @details		Delay a task for a given number of ticks.The actual time that
- * 				the task remains blocked depends on the tick rate.
- * @see			https://www.freertos.org/a00127.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateStatic(). No memory is allocated from the FreeRTOS
+ * 				heap, the buffers must exist as long as the task exists.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::delay(const TickType_t ticksToDelay)
+inline Task::Task(	TaskFunction_t taskFunction,
+					std::string_view taskName,
+					configSTACK_DEPTH_TYPE taskStackSize,
+					void *taskParameters,
+					UBaseType_t taskPriority,
+					StackType_t *stackBuffer,
+					StaticTask_t *taskBuffer)
+					:	functionPointer(taskFunction),
+						stackSize(taskStackSize),
+						parameters(taskParameters)
 {
-	vTaskDelay(ticksToDelay);
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
+
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
+
+	handle = xTaskCreateStatic(functionPointer, nameBuffer, stackSize, (void *) parameters, taskPriority, stackBuffer, taskBuffer);
+
+	assert(handle != NULL);
+
+	addToRegistry();
 }
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
 /**
- * @brief		Delay a task until a specified time
+ * @brief		Constructor, with static memory and core affinity
  *
- * @param		previousWakeTime	Pointer to a variable that holds the time at which the task was last unblocked
- * @param		ticksToIncrement	The cycle time period.
- * @return		void
+ * @param		taskFunction			Pointer to the task entry function
+ * @param		taskName				A descriptive name for the task
+ * @param		taskStackSize			The number of words (not bytes!) in the stackBuffer
+ * @param		taskParameters			A value that is passed as the paramater to the created task
+ * @param		taskPriority			The priority at which the created task will execute
+ * @param		stackBuffer				Array of at least taskStackSize words, used as the task's stack
+ * @param		taskBuffer				Used to hold the task's data structure (TCB)
+ * @param		taskCoreAffinityMask	Bit `n` set allows the task to run on core `n`
  *
- * @details		Delay a task until a specified time. This function can be
- * 				used by periodic tasks to ensure a constant execution frequency.
- * @see			https://www.freertos.org/vtaskdelayuntil.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateStaticAffinitySet(). The task is pinned from the
+ * 				start, so it never runs on another core.
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/01-Task-creation/04-xTaskCreateStaticAffinitySet
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::delayUntil(TickType_t *previousWakeTime, const TickType_t ticksToIncrement)
+inline Task::Task(	TaskFunction_t taskFunction,
+					std::string_view taskName,
+					configSTACK_DEPTH_TYPE taskStackSize,
+					void *taskParameters,
+					UBaseType_t taskPriority,
+					StackType_t *stackBuffer,
+					StaticTask_t *taskBuffer,
+					UBaseType_t taskCoreAffinityMask)
+					:	functionPointer(taskFunction),
+						stackSize(taskStackSize),
+						parameters(taskParameters)
 {
-	vTaskDelayUntil(previousWakeTime, ticksToIncrement);
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
+
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
+
+	handle = xTaskCreateStaticAffinitySet(functionPointer, nameBuffer, stackSize, (void *) parameters, taskPriority, stackBuffer, taskBuffer, taskCoreAffinityMask);
+
+	assert(handle != NULL);
+
+	addToRegistry();
 }
+#endif
 
 /**
- * @brief		Delay a task until a specified time, without previousWakeTime
+ * @brief		Constructor, static task
  *
- * @param		ticksToIncrement	The cycle time period.
- * @return		void
+ * @param		taskFunction	Pointer to the task entry function
+ * @param		taskName		A descriptive name for the task
+ * @param		taskParameters	A value that is passed as the paramater to the created task
+ * @param		taskPriority	The priority at which the created task will execute
  *
- * @details		Delay a task until a specified time. This function can be
- * 				used by periodic tasks to ensure a constant execution frequency.
- * @see			https://www.freertos.org/vtaskdelayuntil.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateStatic(). The stack of `StackDepth` words and the
+ * 				TCB are members of the object, so nothing is allocated at
+ * 				runtime.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
- * @remark		Last Modifications:
- * 				- 21.04.2023	NZ	Mod: That the overloaded function calls
- * 									it's "default" method
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::delayUntil(const TickType_t ticksToIncrement)
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline TaskStatic<StackDepth>::TaskStatic(	TaskFunction_t taskFunction,
+											std::string_view taskName,
+											void *taskParameters,
+											UBaseType_t taskPriority)
+											:	Task(taskFunction, taskName, StackDepth, taskParameters, taskPriority, stackBuffer, &taskBuffer)
 {
-	Task::delayUntil(&currentTickCount, ticksToIncrement);
 }
 
 /**
- * @brief		Obtain the priority
+ * @brief		Constructor, static task with zero as parameters
  *
- * @param		void
- * @return		The priority of the task.
+ * @param		taskFunction	Pointer to the task entry function
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
  *
- * @details		Gets the priority of the current task.
- * @see			https://www.freertos.org/a00128.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateStatic(). And sets the parameters to zero.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline UBaseType_t Task::getPriority(void)
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline TaskStatic<StackDepth>::TaskStatic(	TaskFunction_t taskFunction,
+											std::string_view taskName,
+											UBaseType_t taskPriority)
+											:	Task(taskFunction, taskName, StackDepth, (void *) 0, taskPriority, stackBuffer, &taskBuffer)
 {
-	return uxTaskPriorityGet(NULL);
 }
 
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1) && (configUSE_CORE_AFFINITY == 1)
 /**
- * @brief		Set the priority
+ * @brief		Constructor, static task with core affinity
  *
- * @param		newPriority			The priority to which the task will be set
- * @return		void
+ * @param		taskFunction			Pointer to the task entry function
+ * @param		taskName				A descriptive name for the task
+ * @param		taskParameters			A value that is passed as the paramater to the created task
+ * @param		taskPriority			The priority at which the created task will execute
+ * @param		taskCoreAffinityMask	Bit `n` set allows the task to run on core `n`
  *
- * @details		Sets the priority of the current task.
- * @see			https://www.freertos.org/a00129.html
+ * @details		Constructs a new task object with the FreeRTOS API function
+ * 				xTaskCreateStaticAffinitySet(). The stack and the TCB are
+ * 				members of the object.
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::setPriority(UBaseType_t newPriority)
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline TaskStatic<StackDepth>::TaskStatic(	TaskFunction_t taskFunction,
+											std::string_view taskName,
+											void *taskParameters,
+											UBaseType_t taskPriority,
+											UBaseType_t taskCoreAffinityMask)
+											:	Task(taskFunction, taskName, StackDepth, taskParameters, taskPriority, stackBuffer, &taskBuffer, taskCoreAffinityMask)
 {
-	vTaskPrioritySet(handle, newPriority);
 }
+#endif
 
 /**
- * @brief		Suspend task
+ * @brief		Constructor, static task that is created later
  *
- * @param		void
- * @return		void
+ * @param		taskFunction	Pointer to the task entry function
+ * @param		taskParameters	A value that is passed as the paramater to the created task
  *
- * @details		Suspend current task. When suspended a task will never get
- * 				any microcontroller processing time, no matter what its priority.
- * @see			https://www.freertos.org/a00130.html
+ * @details		Only stores the entry function and the parameters, the task
+ * 				is created with create(). Used by TaskBase, so the task can't
+ * 				run before the derived object is constructed.
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::suspend(void)
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline TaskStatic<StackDepth>::TaskStatic(	TaskFunction_t taskFunction,
+											void *taskParameters)
+											:	Task(taskFunction, StackDepth, taskParameters)
 {
-	vTaskSuspend(handle);
 }
 
 /**
- * @brief		Resume task
+ * @brief		Creates the task of an object constructed without it
  *
- * @param		void
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
  * @return		void
  *
- * @details		A task that has been suspended by one or more calls to
- * 				vTaskSuspend() will be made available for running again by a
- * 				single call to vTaskResume().
- * @see			https://www.freertos.org/a00131.html
+ * @details		Creates the task with the FreeRTOS API function
+ * 				xTaskCreateStatic() on the stack and TCB of the object and
+ * 				adds it to the task registry.
+ * @warning		Call it only once, and only on an object constructed with
+ * 				TaskStatic(taskFunction, taskParameters).
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::resume(void)
+template <configSTACK_DEPTH_TYPE StackDepth>
+inline void TaskStatic<StackDepth>::create(std::string_view taskName, UBaseType_t taskPriority)
 {
-	vTaskResume(handle);
+	char nameBuffer[configMAX_TASK_NAME_LEN]; // Copied by FreeRTOS into the TCB
+
+	assert(this->handle == NULL);
+
+	copyName(nameBuffer, sizeof(nameBuffer), taskName);
+
+	this->handle = xTaskCreateStatic(this->functionPointer, nameBuffer, StackDepth, (void *) this->parameters, taskPriority, stackBuffer, &taskBuffer);
+
+	assert(this->handle != NULL);
+
+	this->addToRegistry();
 }
+#endif
 
 /**
- * @brief		Resume task from ISR
+ * @brief		Destructor
  *
  * @param		void
- * @return		True if it was successful, false otherwise
  *
- * @details		A task that has been suspended by one of more calls to
- * 				vTaskSuspend() will be made available for running again by a
- * 				single call to xTaskResumeFromISR().
- * @see			https://www.freertos.org/taskresumefromisr.html
+ * @details		Deletes a queue object with the FreeRTOS API function
+ * 				vTaskDelete().
+ * @see			https://www.freertos.org/a00126.html
  *
  * @author		N. Zoller (NZ)
  * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Removes the task from the task registry
+ * 				- 14.10.2026	NZ	Mod: Deletes only a created task
  ****************************************************************************/
-inline bool Task::resumeFromISR(void)
+inline Task::~Task(void)
 {
-	return (xTaskResumeFromISR(handle) == pdTRUE) ? true : false;
-}
+	removeFromRegistry();
+
+	if (handle != NULL) {
+		vTaskDelete(handle);
+	}
+};
 
 /**
- * @brief		Request a context switch
+ * @brief		Constructor, task that is created later
  *
- * @param		void
- * @return		True if it was successful, false otherwise
+ * @param		taskFunction	Pointer to the task entry function
+ * @param		taskStackSize	The number of words (not bytes!) of the task's stack
+ * @param		taskParameters	A value that is passed as the paramater to the created task
  *
- * @details		taskYIELD() is used to request a context switch to another task.
- * @see			https://www.freertos.org/a00020.html#taskYIELD
+ * @details		Only stores the values, the handle stays `NULL` until a
+ * 				derived class creates the task.
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline void Task::yield(void)
+inline Task::Task(	TaskFunction_t taskFunction,
+					configSTACK_DEPTH_TYPE taskStackSize,
+					void *taskParameters)
+					:	functionPointer(taskFunction),
+						stackSize(taskStackSize),
+						parameters(taskParameters)
 {
-	taskYIELD();
 }
 
 /**
- * @brief		Gets the task infos
+ * @brief		Adds the task to the registry
  *
- * @param		eState				Manually sets the eState option
- * @return		Returns the status from the vTaskGetInfo()
+ * @param		void
+ * @return		void
  *
- * @details		Gets the TaskStatus_t structure for the current task. The
- * 				TaskStatus_t structure contains, among other things, members
- * 				for the task handle, task name, task priority, task state,
- * 				and total amount of run time consumed by the task.
- * @see			https://www.freertos.org/vTaskGetInfo.html
+ * @details		Adds the task to the intrusive list of all task objects, used
+ * 				by getStackReport(). Needs no memory, the link is a member.
+ * 				The scheduler is suspended while the list is changed.
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline TaskStatus_t Task::getInfo(eTaskState eState)
+inline void Task::addToRegistry(void)
 {
-	vTaskGetInfo(handle, &status, freeStackSpace, eState);
-
-	return status;
+	vTaskSuspendAll();
+	nextTask = firstTask;
+	firstTask = this;
+	xTaskResumeAll();
 }
 
 /**
- * @brief		Gets the task infos, with eState included
+ * @brief		Removes the task from the registry
  *
  * @param		void
- * @return		Returns the status from the vTaskGetInfo()
+ * @return		void
  *
- * @details		Gets the TaskStatus_t structure for the current task. The
- * 				TaskStatus_t structure contains, among other things, members
- * 				for the task handle, task name, task priority, task state,
- * 				and total amount of run time consumed by the task. With the
- * 				eState included as default.
- * @warning		eState used, obtaining the task state is not as fast as a
- * 				simple assignment, so it's uses more time.
- * @see			https://www.freertos.org/vTaskGetInfo.html
+ * @details		Removes the task from the intrusive list of all task objects.
+ * 				The scheduler is suspended while the list is changed.
  *
  * @author		N. Zoller (NZ)
- * @date		14.04.2023	NZ	Created
+ * @date		14.10.2026	NZ	Created
  ****************************************************************************/
-inline TaskStatus_t Task::getInfo(void)
+inline void Task::removeFromRegistry(void)
 {
-	vTaskGetInfo(handle, &status, freeStackSpace, eInvalid);
+	vTaskSuspendAll();
 
-	return status;
+	for (Task **link = &firstTask; *link != NULL; link = &(*link)->nextTask) {
+		if (*link == this) {
+			*link = nextTask;
+			break;
+		}
+	}
+
+	xTaskResumeAll();
 }
 
 /**
- * @brief		Gets the free stack space
+ * @brief		Delay a task
  *
- * @param		void
- * @return		Returns the free stack space from the vTaskGetInfo()
+ * @param		ticksToDelay	The amount of time, in tick periods, that the calling task should block
+ * @return		void
  *
- * @details		Gets the free stack space from the vTaskGetInfo().
- * @warning		This method also updates the status and the freeStackSpace,
- * 				because it calls the function getInfo() before return the
- * 				freeStackSpace.
+ * @details		Delay a task for a given number of ticks.The actual time that
+ * 				the task remains blocked depends on the tick rate.
+ * @see			https://www.freertos.org/a00127.html
  *
  * @author		N. Zoller (NZ)
  * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
-inline BaseType_t Task::getFreeStackSpace(void)
+inline void Task::delay(const TickType_t ticksToDelay)
 {
-	getInfo();
-	return freeStackSpace;
+	WRAPPER_TRACE_ENTER(handle, taskDelay);
+	vTaskDelay(ticksToDelay);
+	WRAPPER_TRACE_EXIT(handle, taskDelay, true);
 }
 
 /**
- * @brief		Gets the task state
+ * @brief		Delay a task until a specified time
  *
- * @param		void
- * @return		Returns the state of the task
+ * @param		previousWakeTime	Pointer to a variable that holds the time at which the task was last unblocked
+ * @param		ticksToIncrement	The cycle time period.
+ * @return		True if the task was delayed, false if the wake time was already missed
  *
- * @details		Returns as an enumerated type the state in which a task
+ * @details		Delay a task until a specified time. This function can be
+ * 				used by periodic tasks to ensure a constant execution frequency.
+ * 				`previousWakeTime` is advanced by `ticksToIncrement` in any
+ * 				case, a missed deadline returns immediately with false.
+ * @see			https://www.freertos.org/xtaskdelayuntil.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Uses xTaskDelayUntil() and returns
+ * 									if the task was delayed
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
+ ****************************************************************************/
+inline bool Task::delayUntil(TickType_t *previousWakeTime, const TickType_t ticksToIncrement)
+{
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, taskDelayUntil);
+	ret = (xTaskDelayUntil(previousWakeTime, ticksToIncrement) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, taskDelayUntil, ret);
+
+	return ret;
+}
+
+/**
+ * @brief		Delay a task until a specified time, without previousWakeTime
+ *
+ * @param		ticksToIncrement	The cycle time period.
+ * @return		True if the task was delayed, false if the wake time was already missed
+ *
+ * @details		Delay a task until a specified time. This function can be
+ * 				used by periodic tasks to ensure a constant execution frequency.
+ * 				The wake time is a member of the object, only used by the task
+ * 				itself. The first call seeds it with the current tick count,
+ * 				so the first delay is one full period.
+ * @see			https://www.freertos.org/xtaskdelayuntil.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 21.04.2023	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
+ * 				- 14.10.2026	NZ	Fix: Seeds the wake time on the first
+ * 									call and returns if the task was delayed
+ ****************************************************************************/
+inline bool Task::delayUntil(const TickType_t ticksToIncrement)
+{
+	if (wakeTimeValid == false) {
+		wakeTime = xTaskGetTickCount();
+		wakeTimeValid = true;
+	}
+
+	return Task::delayUntil(&wakeTime, ticksToIncrement);
+}
+
+/**
+ * @brief		Obtain the priority
+ *
+ * @param		void
+ * @return		The priority of the task.
+ *
+ * @details		Gets the priority of the current task.
+ * @see			https://www.freertos.org/a00128.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ ****************************************************************************/
+inline UBaseType_t Task::getPriority(void)
+{
+	return uxTaskPriorityGet(NULL);
+}
+
+/**
+ * @brief		Set the priority
+ *
+ * @param		newPriority			The priority to which the task will be set
+ * @return		void
+ *
+ * @details		Sets the priority of the current task.
+ * @see			https://www.freertos.org/a00129.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ ****************************************************************************/
+inline void Task::setPriority(UBaseType_t newPriority)
+{
+	vTaskPrioritySet(handle, newPriority);
+}
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+#if (configUSE_CORE_AFFINITY == 1)
+/**
+ * @brief		Set the core affinity
+ *
+ * @param		coreAffinityMask	Bit `n` set allows the task to run on core `n`
+ * @return		void
+ *
+ * @details		Changes the cores the task may run on. If it runs on a core
+ * 				that is no longer allowed, it's moved at once.
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/02-Task-control/13-vTaskCoreAffinitySet
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::setCoreAffinity(UBaseType_t coreAffinityMask)
+{
+	vTaskCoreAffinitySet(handle, coreAffinityMask);
+}
+
+/**
+ * @brief		Get the core affinity
+ *
+ * @param		void
+ * @return		Bit `n` set if the task may run on core `n`
+ *
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/02-Task-control/14-vTaskCoreAffinityGet
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline UBaseType_t Task::getCoreAffinity(void)
+{
+	return vTaskCoreAffinityGet(handle);
+}
+#endif
+
+#if (configUSE_TASK_PREEMPTION_DISABLE == 1)
+/**
+ * @brief		Disables the preemption of the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		The task keeps its core until enablePreemption(), the other
+ * 				cores keep scheduling. Unlike suspendAll() it takes no global
+ * 				lock, so a short section of a pinned task doesn't stall the
+ * 				tasks on the other core.
+ * @warning		It only protects against tasks of the same core, data shared
+ * 				with the other core still needs a lock-free structure or a
+ * 				critical section.
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/02-Task-control/15-vTaskPreemptionDisable
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::disablePreemption(void)
+{
+	vTaskPreemptionDisable(handle);
+}
+
+/**
+ * @brief		Enables the preemption of the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @see			https://www.freertos.org/Documentation/02-Kernel/04-API-references/02-Task-control/16-vTaskPreemptionEnable
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::enablePreemption(void)
+{
+	vTaskPreemptionEnable(handle);
+}
+#endif
+#endif
+
+/**
+ * @brief		Deletes the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Removes the task from the registry and deletes it with
+ * 				vTaskDelete(). A task that deletes itself must use this
+ * 				instead of `vTaskDelete(NULL)`, else its dangling handle stays
+ * 				in the registry of getStackReport(). Called by the task itself
+ * 				it doesn't return. Does nothing if the task doesn't exist.
+ * @see			https://www.freertos.org/a00126.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::deleteTask(void)
+{
+	TaskHandle_t taskHandle = handle; // Task to delete
+
+	if (taskHandle == NULL) {
+		return;
+	}
+
+	removeFromRegistry();
+	handle = NULL;
+
+	vTaskDelete(taskHandle);
+}
+
+/**
+ * @brief		Suspend task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Suspend current task. When suspended a task will never get
+ * 				any microcontroller processing time, no matter what its priority.
+ * @see			https://www.freertos.org/a00130.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ ****************************************************************************/
+inline void Task::suspend(void)
+{
+	vTaskSuspend(handle);
+}
+
+/**
+ * @brief		Resume task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		A task that has been suspended by one or more calls to
+ * 				vTaskSuspend() will be made available for running again by a
+ * 				single call to vTaskResume().
+ * @see			https://www.freertos.org/a00131.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ ****************************************************************************/
+inline void Task::resume(void)
+{
+	vTaskResume(handle);
+}
+
+/**
+ * @brief		Resume task from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if a context switch is required, false otherwise
+ *
+ * @details		A task that has been suspended by one of more calls to
+ * 				vTaskSuspend() will be made available for running again by a
+ * 				single call to xTaskResumeFromISR(). If the resumed task has
+ * 				a higher priority than the interrupted one,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE. Like the other
+ * 				FromISR methods it is never set to pdFALSE.
+ * @see			https://www.freertos.org/taskresumefromisr.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::resumeFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	BaseType_t ret; // Temporary return value
+
+	ret = xTaskResumeFromISR(handle);
+
+	if ((ret == pdTRUE) && (higherPriorityTaskWoken != NULL)) {
+		*higherPriorityTaskWoken = pdTRUE;
+	}
+
+	return (ret == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Resume task from ISR
+ *
+ * @param		void
+ * @return		True if a context switch is required, false otherwise
+ *
+ * @details		A task that has been suspended by one of more calls to
+ * 				vTaskSuspend() will be made available for running again by a
+ * 				single call to xTaskResumeFromISR().
+ * @see			https://www.freertos.org/taskresumefromisr.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: That the overloaded function calls
+ * 									it's "default" method
+ ****************************************************************************/
+inline bool Task::resumeFromISR(void)
+{
+	return Task::resumeFromISR(NULL);
+}
+
+/**
+ * @brief		Request a context switch
+ *
+ * @param		void
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		taskYIELD() is used to request a context switch to another task.
+ * @see			https://www.freertos.org/a00020.html#taskYIELD
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ ****************************************************************************/
+inline void Task::yield(void)
+{
+	taskYIELD();
+}
+
+/**
+ * @brief		Gets the task infos
+ *
+ * @param		eState				Manually sets the eState option
+ * @param		getFreeStackSpace	True to scan the stack for the high water mark
+ * @return		Returns the status from the vTaskGetInfo()
+ *
+ * @details		Gets the TaskStatus_t structure for the current task. The
+ * 				TaskStatus_t structure contains, among other things, members
+ * 				for the task handle, task name, task priority, task state,
+ * 				and total amount of run time consumed by the task. The stack
+ * 				high water mark is only filled if `getFreeStackSpace` is true.
+ * @warning		Scanning the stack takes a relatively long time, so it's
+ * 				skipped by default.
+ * @see			https://www.freertos.org/vTaskGetInfo.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Parameter for the stack high water
+ * 									mark, no uninitialized flag anymore
+ ****************************************************************************/
+inline TaskStatus_t Task::getInfo(eTaskState eState, bool getFreeStackSpace)
+{
+	vTaskGetInfo(handle, &status, (getFreeStackSpace == true) ? pdTRUE : pdFALSE, eState);
+
+	return status;
+}
+
+/**
+ * @brief		Gets the task infos, with eState included
+ *
+ * @param		void
+ * @return		Returns the status from the vTaskGetInfo()
+ *
+ * @details		Gets the TaskStatus_t structure for the current task. The
+ * 				TaskStatus_t structure contains, among other things, members
+ * 				for the task handle, task name, task priority, task state,
+ * 				and total amount of run time consumed by the task. With the
+ * 				eState included as default.
+ * @warning		eState used, obtaining the task state is not as fast as a
+ * 				simple assignment, so it's uses more time.
+ * @see			https://www.freertos.org/vTaskGetInfo.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: No uninitialized flag anymore, the
+ * 									stack isn't scanned
+ ****************************************************************************/
+inline TaskStatus_t Task::getInfo(void)
+{
+	return Task::getInfo(eInvalid, false);
+}
+
+/**
+ * @brief		Gets the free stack space
+ *
+ * @param		void
+ * @return		Returns the minimum free stack space in words
+ *
+ * @details		Same as getStackHighWaterMark(), the minimum amount of stack
+ * 				that was free since the task started.
+ * @see			https://www.freertos.org/uxTaskGetStackHighWaterMark.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Returns the high water mark instead
+ * 									of the uninitialized freeStackSpace
+ ****************************************************************************/
+inline UBaseType_t Task::getFreeStackSpace(void)
+{
+	return Task::getStackHighWaterMark();
+}
+
+/**
+ * @brief		Gets the stack high water mark
+ *
+ * @param		void
+ * @return		Returns the minimum free stack space in words
+ *
+ * @details		Returns the minimum amount of stack, in words, that was free
+ * 				since the task started. The closer to zero, the closer the
+ * 				task came to overflow its stack. Only scans the stack and
+ * 				doesn't fill a whole TaskStatus_t like getInfo().
+ * @warning		Needs `INCLUDE_uxTaskGetStackHighWaterMark` set to 1.
+ * @see			https://www.freertos.org/uxTaskGetStackHighWaterMark.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline UBaseType_t Task::getStackHighWaterMark(void)
+{
+	return uxTaskGetStackHighWaterMark(handle);
+}
+
+/**
+ * @brief		Creates a stack report of all tasks
+ *
+ * @param		report			Array to store the usage of the tasks
+ * @param		maxEntries		Number of entries in the array
+ * @param		marginPercent	Margin added to the used stack for the recommendation
+ * @return		Number of entries written to the array
+ *
+ * @details		Walks through all tasks created with this class (and the
+ * 				derived ones) and stores the stack size, the maximum used
+ * 				stack and a recommended stack size, all in words. The
+ * 				recommendation is the used stack plus `marginPercent`, but at
+ * 				least `configMINIMAL_STACK_SIZE`. Stacks that are much bigger
+ * 				than recommended can be trimmed, after all code paths ran.
+ * 				The scheduler is only suspended while the registry is copied
+ * 				into the report, the stacks are scanned afterwards with the
+ * 				scheduler running. Tasks that were deleted with a plain
+ * 				vTaskDelete() in the meantime are dropped from the report.
+ * @warning		Tasks must not be deleted with deleteTask() or destroyed while
+ * 				the report is created. Dynamic tasks that deleted themselves with
+ * 				`vTaskDelete(NULL)` leave a dangling handle, use deleteTask().
+ * @see			https://www.freertos.org/uxTaskGetStackHighWaterMark.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Scans the stacks with the scheduler
+ * 									running, skips deleted tasks
+ ****************************************************************************/
+inline UBaseType_t Task::getStackReport(StackUsage *report, UBaseType_t maxEntries, UBaseType_t marginPercent)
+{
+	UBaseType_t copied = 0; // Number of tasks copied from the registry
+	UBaseType_t count = 0; // Number of entries written
+	configSTACK_DEPTH_TYPE used; // Maximum used stack of a task
+	configSTACK_DEPTH_TYPE recommended; // Recommended stack size of a task
+
+	vTaskSuspendAll();
+
+	for (Task *task = firstTask; (task != NULL) && (copied < maxEntries); task = task->nextTask) {
+		if (task->handle != NULL) {
+			report[copied].name = pcTaskGetName(task->handle);
+			report[copied].handle = task->handle;
+			report[copied].stackSize = task->stackSize;
+			copied++;
+		}
+	}
+
+	xTaskResumeAll();
+
+	for (UBaseType_t i = 0; i < copied; i++) {
+		if (eTaskGetState(report[i].handle) == eDeleted) {
+			continue;
+		}
+
+		used = report[i].stackSize - (configSTACK_DEPTH_TYPE) uxTaskGetStackHighWaterMark(report[i].handle);
+		recommended = used + (configSTACK_DEPTH_TYPE) (((uint32_t) used * marginPercent + 99) / 100);
+
+		if (recommended < configMINIMAL_STACK_SIZE) {
+			recommended = configMINIMAL_STACK_SIZE;
+		}
+
+		report[count] = report[i];
+		report[count].used = used;
+		report[count].recommended = recommended;
+		count++;
+	}
+
+	return count;
+}
+
+/**
+ * @brief		Creates a stack report of all tasks, with the default margin
+ *
+ * @param		report			Array to store the usage of the tasks
+ * @param		maxEntries		Number of entries in the array
+ * @return		Number of entries written to the array
+ *
+ * @details		Creates the report with a margin of 20 % over the maximum
+ * 				used stack.
+ * @see			https://www.freertos.org/uxTaskGetStackHighWaterMark.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline UBaseType_t Task::getStackReport(StackUsage *report, UBaseType_t maxEntries)
+{
+	return Task::getStackReport(report, maxEntries, 20);
+}
+
+/**
+ * @brief		Gets the task state
+ *
+ * @param		void
+ * @return		Returns the state of the task
+ *
+ * @details		Returns as an enumerated type the state in which a task
  * 				existed at the time getState() was executed.
  * @see			https://www.freertos.org/a00021.html#eTaskGetState
  *
@@ -505,17 +1335,527 @@ inline TickType_t  Task::updateTickCountFromISR(void)
  * @param		void
  * return		Returns the name of the task
  *
- * @details		This function gets the name of the task from the class,
- * 				not from the task of FreeRTOS.
+ * @details		This function gets the name of the task from the TCB of
+ * 				FreeRTOS, no copy of the name is made.
+ * @see			https://www.freertos.org/a00021.html#pcTaskGetName
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Returns a pointer to the name in
+ * 									the TCB instead of a std::string
  ****************************************************************************/
-inline std::string Task::getName(void)
+inline const char *Task::getName(void)
 {
 	return pcTaskGetName(handle);
 }
 
+/**
+ * @brief		Sends a notification to the task
+ *
+ * @param		indexToNotify	Index of the notification in the array
+ * @param		value			Value used to update the notification value
+ * @param		action			How the value is used, see `eNotifyAction`
+ * @return		False if `eSetValueWithoutOverwrite` failed, true otherwise
+ *
+ * @details		Sends a direct to task notification. Notifications need no
+ * 				extra kernel object and unblock the receiving task faster
+ * 				than a binary semaphore. The index must be lower than
+ * 				`configTASK_NOTIFICATION_ARRAY_ENTRIES`.
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notify(UBaseType_t indexToNotify, uint32_t value, eNotifyAction action)
+{
+	return (xTaskNotifyIndexed(handle, indexToNotify, value, action) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Sends a notification to the task, with the default index
+ *
+ * @param		value			Value used to update the notification value
+ * @param		action			How the value is used, see `eNotifyAction`
+ * @return		False if `eSetValueWithoutOverwrite` failed, true otherwise
+ *
+ * @details		Sends a direct to task notification to the default index
+ * 				`tskDEFAULT_INDEX_TO_NOTIFY`.
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notify(uint32_t value, eNotifyAction action)
+{
+	return Task::notify(tskDEFAULT_INDEX_TO_NOTIFY, value, action);
+}
+
+/**
+ * @brief		Sends a notification to the task from an ISR
+ *
+ * @param		indexToNotify				Index of the notification in the array
+ * @param		value						Value used to update the notification value
+ * @param		action						How the value is used, see `eNotifyAction`
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		False if `eSetValueWithoutOverwrite` failed, true otherwise
+ *
+ * @details		Sends a direct to task notification from an interrupt service
+ * 				routine. If the notified task has a higher priority than the
+ * 				interrupted one, `higherPriorityTaskWoken` is set to pdTRUE.
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyFromISR(UBaseType_t indexToNotify, uint32_t value, eNotifyAction action, BaseType_t *higherPriorityTaskWoken)
+{
+	return (xTaskNotifyIndexedFromISR(handle, indexToNotify, value, action, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Sends a notification to the task from an ISR, with the default index
+ *
+ * @param		value						Value used to update the notification value
+ * @param		action						How the value is used, see `eNotifyAction`
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		False if `eSetValueWithoutOverwrite` failed, true otherwise
+ *
+ * @details		Sends a direct to task notification to the default index
+ * 				from an interrupt service routine.
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyFromISR(uint32_t value, eNotifyAction action, BaseType_t *higherPriorityTaskWoken)
+{
+	return Task::notifyFromISR(tskDEFAULT_INDEX_TO_NOTIFY, value, action, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Increments the notification value of the task
+ *
+ * @param		indexToNotify	Index of the notification in the array
+ * @return		void
+ *
+ * @details		Lightweight replacement of Semaphore::give(), the task
+ * 				receives it with notifyTake().
+ * @see			https://www.freertos.org/xTaskNotifyGive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyGive(UBaseType_t indexToNotify)
+{
+	xTaskNotifyGiveIndexed(handle, indexToNotify);
+}
+
+/**
+ * @brief		Increments the notification value of the task, with the default index
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Lightweight replacement of Semaphore::give(), the task
+ * 				receives it with notifyTake().
+ * @see			https://www.freertos.org/xTaskNotifyGive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyGive(void)
+{
+	Task::notifyGive(tskDEFAULT_INDEX_TO_NOTIFY);
+}
+
+/**
+ * @brief		Increments the notification value of the task from an ISR
+ *
+ * @param		indexToNotify				Index of the notification in the array
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Lightweight replacement of Semaphore::giveFromISR(). If the
+ * 				notified task has a higher priority than the interrupted one,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE.
+ * @see			https://www.freertos.org/vTaskNotifyGiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyGiveFromISR(UBaseType_t indexToNotify, BaseType_t *higherPriorityTaskWoken)
+{
+	vTaskNotifyGiveIndexedFromISR(handle, indexToNotify, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Increments the notification value from an ISR, with the default index
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Lightweight replacement of Semaphore::giveFromISR().
+ * @see			https://www.freertos.org/vTaskNotifyGiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyGiveFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	Task::notifyGiveFromISR(tskDEFAULT_INDEX_TO_NOTIFY, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Sets bits in the notification value of the task
+ *
+ * @param		indexToNotify	Index of the notification in the array
+ * @param		bitsToSet		Bits to OR into the notification value
+ * @return		void
+ *
+ * @details		Lightweight replacement of an event group, the task receives
+ * 				the bits with waitFor() or notifyWait().
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifySetBits(UBaseType_t indexToNotify, uint32_t bitsToSet)
+{
+	xTaskNotifyIndexed(handle, indexToNotify, bitsToSet, eSetBits);
+}
+
+/**
+ * @brief		Sets bits in the notification value, with the default index
+ *
+ * @param		bitsToSet		Bits to OR into the notification value
+ * @return		void
+ *
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifySetBits(uint32_t bitsToSet)
+{
+	Task::notifySetBits(tskDEFAULT_INDEX_TO_NOTIFY, bitsToSet);
+}
+
+/**
+ * @brief		Sets bits in the notification value of the task from an ISR
+ *
+ * @param		indexToNotify				Index of the notification in the array
+ * @param		bitsToSet					Bits to OR into the notification value
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Sets the bits from an interrupt service routine. Unlike
+ * 				xEventGroupSetBitsFromISR() this is not deferred to the timer
+ * 				daemon task.
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifySetBitsFromISR(UBaseType_t indexToNotify, uint32_t bitsToSet, BaseType_t *higherPriorityTaskWoken)
+{
+	xTaskNotifyIndexedFromISR(handle, indexToNotify, bitsToSet, eSetBits, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Sets bits in the notification value from an ISR, with the default index
+ *
+ * @param		bitsToSet					Bits to OR into the notification value
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifySetBitsFromISR(uint32_t bitsToSet, BaseType_t *higherPriorityTaskWoken)
+{
+	Task::notifySetBitsFromISR(tskDEFAULT_INDEX_TO_NOTIFY, bitsToSet, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Overwrites the notification value of the task
+ *
+ * @param		indexToNotify	Index of the notification in the array
+ * @param		value			New notification value
+ * @return		void
+ *
+ * @details		Lightweight replacement of a mailbox (queue of length one),
+ * 				the notification value is overwritten even if the task has
+ * 				not yet read the last one.
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyOverwrite(UBaseType_t indexToNotify, uint32_t value)
+{
+	xTaskNotifyIndexed(handle, indexToNotify, value, eSetValueWithOverwrite);
+}
+
+/**
+ * @brief		Overwrites the notification value, with the default index
+ *
+ * @param		value			New notification value
+ * @return		void
+ *
+ * @see			https://www.freertos.org/xTaskNotify.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyOverwrite(uint32_t value)
+{
+	Task::notifyOverwrite(tskDEFAULT_INDEX_TO_NOTIFY, value);
+}
+
+/**
+ * @brief		Overwrites the notification value of the task from an ISR
+ *
+ * @param		indexToNotify				Index of the notification in the array
+ * @param		value						New notification value
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyOverwriteFromISR(UBaseType_t indexToNotify, uint32_t value, BaseType_t *higherPriorityTaskWoken)
+{
+	xTaskNotifyIndexedFromISR(handle, indexToNotify, value, eSetValueWithOverwrite, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Overwrites the notification value from an ISR, with the default index
+ *
+ * @param		value						New notification value
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @see			https://www.freertos.org/xTaskNotifyFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Task::notifyOverwriteFromISR(uint32_t value, BaseType_t *higherPriorityTaskWoken)
+{
+	Task::notifyOverwriteFromISR(tskDEFAULT_INDEX_TO_NOTIFY, value, higherPriorityTaskWoken);
+}
+
+/**
+ * @brief		Clears a pending notification of the task
+ *
+ * @param		indexToClear	Index of the notification in the array
+ * @return		True if a notification was pending, false otherwise
+ *
+ * @details		Sets the notification state to not pending, the
+ * 				notification value is not changed.
+ * @see			https://www.freertos.org/xTaskNotifyStateClear.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyStateClear(UBaseType_t indexToClear)
+{
+	return (xTaskNotifyStateClearIndexed(handle, indexToClear) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Clears a pending notification, with the default index
+ *
+ * @param		void
+ * @return		True if a notification was pending, false otherwise
+ *
+ * @see			https://www.freertos.org/xTaskNotifyStateClear.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyStateClear(void)
+{
+	return Task::notifyStateClear(tskDEFAULT_INDEX_TO_NOTIFY);
+}
+
+/**
+ * @brief		Clears bits in the notification value of the task
+ *
+ * @param		indexToClear	Index of the notification in the array
+ * @param		bitsToClear		Bits to clear in the notification value
+ * @return		The notification value before the bits were cleared
+ *
+ * @see			https://www.freertos.org/ulTasknotifyValueClear.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::notifyValueClear(UBaseType_t indexToClear, uint32_t bitsToClear)
+{
+	return ulTaskNotifyValueClearIndexed(handle, indexToClear, bitsToClear);
+}
+
+/**
+ * @brief		Clears bits in the notification value, with the default index
+ *
+ * @param		bitsToClear		Bits to clear in the notification value
+ * @return		The notification value before the bits were cleared
+ *
+ * @see			https://www.freertos.org/ulTasknotifyValueClear.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::notifyValueClear(uint32_t bitsToClear)
+{
+	return Task::notifyValueClear(tskDEFAULT_INDEX_TO_NOTIFY, bitsToClear);
+}
+
+/**
+ * @brief		Waits for a notification of the calling task, like a semaphore
+ *
+ * @param		indexToWaitOn		Index of the notification in the array
+ * @param		clearCountOnExit	True to clear the value, false to decrement it
+ * @param		ticksToWait			Ticks to wait for a notification
+ * @return		The notification value before it was cleared or decremented
+ *
+ * @details		Counterpart of notifyGive(). Has to be called by the task that
+ * 				waits, so it is static. Used as binary semaphore with
+ * 				`clearCountOnExit` true and as counting semaphore with false.
+ * 				A return value of 0 means the time expired.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::notifyTake(UBaseType_t indexToWaitOn, bool clearCountOnExit, TickType_t ticksToWait)
+{
+	return ulTaskNotifyTakeIndexed(indexToWaitOn, (clearCountOnExit == true) ? pdTRUE : pdFALSE, ticksToWait);
+}
+
+/**
+ * @brief		Waits for a notification of the calling task, with the default index
+ *
+ * @param		clearCountOnExit	True to clear the value, false to decrement it
+ * @param		ticksToWait			Ticks to wait for a notification
+ * @return		The notification value before it was cleared or decremented
+ *
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::notifyTake(bool clearCountOnExit, TickType_t ticksToWait)
+{
+	return Task::notifyTake(tskDEFAULT_INDEX_TO_NOTIFY, clearCountOnExit, ticksToWait);
+}
+
+/**
+ * @brief		Waits for a notification of the calling task
+ *
+ * @param		indexToWaitOn		Index of the notification in the array
+ * @param		bitsToClearOnEntry	Bits to clear in the value before waiting
+ * @param		bitsToClearOnExit	Bits to clear in the value before returning
+ * @param		notificationValue	Stores the value before clearing, NULL if not needed
+ * @param		ticksToWait			Ticks to wait for a notification
+ * @return		True if a notification was received, false if the time expired
+ *
+ * @details		Has to be called by the task that waits, so it is static.
+ * @see			https://www.freertos.org/xTaskNotifyWait.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyWait(UBaseType_t indexToWaitOn, uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, TickType_t ticksToWait)
+{
+	return (xTaskNotifyWaitIndexed(indexToWaitOn, bitsToClearOnEntry, bitsToClearOnExit, notificationValue, ticksToWait) == pdTRUE) ? true : false;
+}
+
+/**
+ * @brief		Waits for a notification of the calling task, with the default index
+ *
+ * @param		bitsToClearOnEntry	Bits to clear in the value before waiting
+ * @param		bitsToClearOnExit	Bits to clear in the value before returning
+ * @param		notificationValue	Stores the value before clearing, NULL if not needed
+ * @param		ticksToWait			Ticks to wait for a notification
+ * @return		True if a notification was received, false if the time expired
+ *
+ * @see			https://www.freertos.org/xTaskNotifyWait.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Task::notifyWait(uint32_t bitsToClearOnEntry, uint32_t bitsToClearOnExit, uint32_t *notificationValue, TickType_t ticksToWait)
+{
+	return Task::notifyWait(tskDEFAULT_INDEX_TO_NOTIFY, bitsToClearOnEntry, bitsToClearOnExit, notificationValue, ticksToWait);
+}
+
+/**
+ * @brief		Waits until one of the given bits is notified
+ *
+ * @param		indexToWaitOn		Index of the notification in the array
+ * @param		bitsToWaitFor		Bits of interest
+ * @param		ticksToWait			Ticks to wait in total
+ * @return		The bits of interest that were set, 0 if the time expired
+ *
+ * @details		Counterpart of notifySetBits(). Blocks the calling task until
+ * 				at least one of `bitsToWaitFor` is set, bits set before the
+ * 				call return at once. The returned bits are cleared with
+ * 				ulTaskNotifyValueClearIndexed(), all other bits stay untouched
+ * 				for a later call. Notifications with other bits don't extend
+ * 				the total wait.
+ * @see			https://www.freertos.org/xTaskNotifyWait.html
+ * @see			https://www.freertos.org/ulTasknotifyValueClear.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::waitFor(UBaseType_t indexToWaitOn, uint32_t bitsToWaitFor, TickType_t ticksToWait)
+{
+	TimeOut_t timeOut; // Start time of the wait
+	uint32_t value; // Bits of interest that were set
+
+	vTaskSetTimeOutState(&timeOut);
+
+	for (;;) {
+		value = ulTaskNotifyValueClearIndexed(NULL, indexToWaitOn, bitsToWaitFor) & bitsToWaitFor;
+
+		if (value != 0) {
+			return value;
+		}
+
+		if (xTaskCheckForTimeOut(&timeOut, &ticksToWait) == pdTRUE) {
+			return 0;
+		}
+
+		// Clears the pending state only, the bits are checked in the next pass
+		(void) xTaskNotifyWaitIndexed(indexToWaitOn, 0, 0, NULL, ticksToWait);
+	}
+}
+
+/**
+ * @brief		Waits until one of the given bits is notified, with the default index
+ *
+ * @param		bitsToWaitFor		Bits of interest
+ * @param		ticksToWait			Ticks to wait in total
+ * @return		The bits of interest that were set, 0 if the time expired
+ *
+ * @see			https://www.freertos.org/xTaskNotifyWait.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline uint32_t Task::waitFor(uint32_t bitsToWaitFor, TickType_t ticksToWait)
+{
+	return Task::waitFor(tskDEFAULT_INDEX_TO_NOTIFY, bitsToWaitFor, ticksToWait);
+}
+
 /****************************************************************************/
 /* End Header : Task Class													*/
 /****************************************************************************/
@@ -0,0 +1,278 @@
+#ifndef TASKBASE_HPP_
+#define TASKBASE_HPP_
+/****************************************************************************/
+/*  Header    : Task Base Class												*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : TaskBase.hpp												*/
+/*                                                                          */
+/*  @brief	  : CRTP task base and task from a callable, both without		*/
+/*				std::function and without heap								*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- 14.10.2026	NZ	Mod: TaskBase creates the task in start()	*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+#include "Task.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+class TaskBase : public TaskStatic<StackDepth>
+{
+protected:
+	char							name[configMAX_TASK_NAME_LEN];
+	const UBaseType_t				priority;
+
+	TaskBase(std::string_view taskName, UBaseType_t taskPriority);
+
+	~TaskBase(void);
+
+	void static entry(void *taskParameters);
+
+public:
+	TaskBase(const TaskBase &) = delete;
+	TaskBase &operator=(const TaskBase &) = delete;
+
+	void start(void);
+
+	void stop(void);
+};
+
+/* Class definition            */
+template <typename Callable>
+class TaskCallableStorage
+{
+protected:
+	Callable						callable;
+
+	TaskCallableStorage(Callable &&taskCallable): callable(std::move(taskCallable)) {};
+	TaskCallableStorage(const Callable &taskCallable): callable(taskCallable) {};
+};
+
+/* Class definition            */
+template <typename Callable, configSTACK_DEPTH_TYPE StackDepth>
+class TaskCallable : protected TaskCallableStorage<Callable>, public TaskStatic<StackDepth>
+{
+	static_assert(std::is_invocable_v<Callable &>, "Callable must be invocable without arguments");
+
+protected:
+	void static entry(void *taskParameters);
+
+public:
+	template <typename C>
+	TaskCallable(std::string_view taskName, UBaseType_t taskPriority, C &&taskCallable);
+
+	TaskCallable(const TaskCallable &) = delete;
+	TaskCallable &operator=(const TaskCallable &) = delete;
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
+ *
+ * @details		Prepares a static task with `StackDepth` words of stack that
+ * 				calls `Derived::run()`. The object itself is passed as the task
+ * 				parameter, the trampoline entry() is generated per `Derived`
+ * 				so the call to run() is direct and can be inlined.
+ * 				`Derived::run()` has to be public or `TaskBase` a friend.
+ * 				The task isn't created yet, the members of `Derived` don't
+ * 				exist at this point. It's created by start().
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Task is created in start()
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline TaskBase<Derived, StackDepth>::TaskBase(	std::string_view taskName,
+												UBaseType_t taskPriority)
+												:	TaskStatic<StackDepth>(&TaskBase::entry, static_cast<Derived *>(this)),
+													priority(taskPriority)
+{
+	FreeRTOS::copyName(name, sizeof(name), taskName);
+}
+
+/**
+ * @brief		Destructor
+ *
+ * @details		The members of `Derived` are already destroyed here, so a
+ * 				task still running run() would use them. `Derived` has to
+ * 				call stop() first, e.g. in its destructor.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline TaskBase<Derived, StackDepth>::~TaskBase(void)
+{
+	assert(this->handle == NULL);
+}
+
+/**
+ * @brief		Creates and starts the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Creates the task with xTaskCreateStatic(). Call it once the
+ * 				object is fully constructed, e.g. after its definition or as
+ * 				the last statement of the constructor of the most derived
+ * 				class, so run() never sees a partly constructed object.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline void TaskBase<Derived, StackDepth>::start(void)
+{
+	this->create(name, priority);
+}
+
+/**
+ * @brief		Deletes the task
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Deletes the task with Task::deleteTask(), so it no longer
+ * 				runs before the members of `Derived` are destroyed. Called by the task itself it doesn't
+ * 				return. Does nothing if the task wasn't started.
+ * @see			https://www.freertos.org/a00126.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline void TaskBase<Derived, StackDepth>::stop(void)
+{
+	this->deleteTask();
+}
+
+/**
+ * @brief		Task entry function
+ *
+ * @param		taskParameters	Pointer to the `Derived` object
+ * @return		void
+ *
+ * @details		Casts the parameter back to the `Derived` object and calls
+ * 				run(). A FreeRTOS task must never return, so the task
+ * 				suspends itself if run() returns. It is deleted by stop().
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Derived, configSTACK_DEPTH_TYPE StackDepth>
+inline void TaskBase<Derived, StackDepth>::entry(void *taskParameters)
+{
+	static_cast<Derived *>(taskParameters)->run();
+
+	for (;;) {
+		vTaskSuspend(NULL);
+	}
+}
+
+/**
+ * @brief		Constructor
+ *
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
+ * @param		taskCallable	Callable without arguments, executed by the task
+ *
+ * @details		Stores the callable inside the object and creates a static
+ * 				task with `StackDepth` words of stack that invokes it. The
+ * 				callable is constructed before the task is created, so it
+ * 				is safe to use from the first instruction of the task.
+ * 				Use makeTask() to deduce `Callable` from a lambda.
+ * @see			https://www.freertos.org/xTaskCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Callable, configSTACK_DEPTH_TYPE StackDepth>
+template <typename C>
+inline TaskCallable<Callable, StackDepth>::TaskCallable(	std::string_view taskName,
+															UBaseType_t taskPriority,
+															C &&taskCallable)
+															:	TaskCallableStorage<Callable>(std::forward<C>(taskCallable)),
+																TaskStatic<StackDepth>(&TaskCallable::entry, taskName, static_cast<TaskCallableStorage<Callable> *>(this), taskPriority)
+{
+}
+
+/**
+ * @brief		Task entry function
+ *
+ * @param		taskParameters	Pointer to the storage of the callable
+ * @return		void
+ *
+ * @details		Invokes the stored callable. A FreeRTOS task must never
+ * 				return, so the task suspends itself if the callable returns.
+ * 				It is deleted by the destructor of the object.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Callable, configSTACK_DEPTH_TYPE StackDepth>
+inline void TaskCallable<Callable, StackDepth>::entry(void *taskParameters)
+{
+	static_cast<TaskCallable *>(static_cast<TaskCallableStorage<Callable> *>(taskParameters))->callable();
+
+	for (;;) {
+		vTaskSuspend(NULL);
+	}
+}
+
+/**
+ * @brief		Creates a task from a callable
+ *
+ * @param		taskName		A descriptive name for the task
+ * @param		taskPriority	The priority at which the created task will execute
+ * @param		taskCallable	Callable without arguments, executed by the task
+ * @return		The task object
+ *
+ * @details		Deduces the type of the callable, e.g.
+ * 				`auto task = makeTask<256>("led", 1, [&] { ... });`.
+ * 				The object is constructed in place (guaranteed copy elision),
+ * 				it is never copied or moved.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <configSTACK_DEPTH_TYPE StackDepth, typename C>
+inline TaskCallable<std::decay_t<C>, StackDepth> makeTask(std::string_view taskName, UBaseType_t taskPriority, C &&taskCallable)
+{
+	return TaskCallable<std::decay_t<C>, StackDepth>(taskName, taskPriority, std::forward<C>(taskCallable));
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Task Base Class												*/
+/****************************************************************************/
+#endif /* TASKBASE_HPP_ */
@@ -16,28 +16,35 @@
 /* 				- 10.04.2023	NZ	Mod: Header, add doxygen commands		*/
 /*				- 21.04.2023	NZ	Mod: Combined .cpp and .hpp and made the*/
 /*									methods inline							*/
+/*				- 14.10.2026	NZ	Add: Static allocation, TimerStatic		*/
+/*									class									*/
+/*				- 14.10.2026	NZ	Mod: Name as std::string_view, stored	*/
+/*									in a fixed size buffer					*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*				- 14.10.2026	NZ	Add: Optional trace of the blocking calls*/
+/*				- 14.10.2026	NZ	Add: FromISR methods, getExpiryTime(),	*/
+/*									setReloadMode() and getReloadMode()		*/
+/*				- 14.10.2026	NZ	Fix: Timer ID casts through intptr_t	*/
+/*				- 14.10.2026	NZ	Mod: Includes the wrapper headers it	*/
+/*									depends on								*/
 /*																			*/
-/*  @todo	  :	- Add this functions from API								*/
-/*					- xTimerCreateStatic() 									*/
-/*					- xTimerStartFromISR() 									*/
-/*					- xTimerStopFromISR() 									*/
-/*					- xTimerChangePeriodFromISR()							*/
-/*					- xTimerResetFromISR() 									*/
-/*					- vTimerSetReloadMode()									*/
-/*					- pcTimerGetName()	 									*/
-/*					- xTimerGetExpiryTime()									*/
-/*					- xTimerGetReloadMode()									*/
-/*				- Test the whole class extensively							*/
+/*  @todo	  :	- Test the whole class extensively							*/
 /*																			*/
 /****************************************************************************/
 /*																			*/
 /****************************************************************************/
 
 /* imports */
-#include <string>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
 
+#include <FreeRTOS.h>
 #include <timers.h>
 
+#include "FreeRTOS.hpp"
+#include "Trace.hpp"
+
 /* Class constant declaration  */
 
 /* Class Type declaration      */
@@ -49,42 +56,95 @@ class Timer : public FreeRTOS
 {
 protected:
 	TimerHandle_t					handle;
-	const std::string				name;
+	char							name[configMAX_TASK_NAME_LEN];
 	const TimerCallbackFunction_t	callbackFunc;
 
 	TickType_t						defaultBlockTime = 0;
 
 public:
-	Timer(std::string timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc);
-	Timer(std::string timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc);
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+	Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc);
+	Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc);
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+	Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc, StaticTimer_t *timerBuffer);
+#endif
 
 	~Timer(void);
 
 	bool isActive(void);
 
 	bool start(TickType_t blockTime);
+	template <typename Rep, typename Period>
+	bool start(const std::chrono::duration<Rep, Period> blockTime)							{return start(convertToTicks(blockTime));};
 	bool start(void);
 
+	bool startFromISR(BaseType_t *higherPriorityTaskWoken);
+	bool startFromISR(void);
+
 	bool stop(TickType_t blockTime);
+	template <typename Rep, typename Period>
+	bool stop(const std::chrono::duration<Rep, Period> blockTime)							{return stop(convertToTicks(blockTime));};
 	bool stop(void);
 
+	bool stopFromISR(BaseType_t *higherPriorityTaskWoken);
+	bool stopFromISR(void);
+
 	bool reset(TickType_t blockTime);
+	template <typename Rep, typename Period>
+	bool reset(const std::chrono::duration<Rep, Period> blockTime)							{return reset(convertToTicks(blockTime));};
 	bool reset(void);
 
+	bool resetFromISR(BaseType_t *higherPriorityTaskWoken);
+	bool resetFromISR(void);
+
 	bool setPeriod(TickType_t newPeriod, TickType_t blockTime);
 	bool setPeriod(TickType_t newPeriod);
+	template <typename RepPeriod, typename PeriodPeriod, typename Rep, typename Period>
+	bool setPeriod(const std::chrono::duration<RepPeriod, PeriodPeriod> newPeriod, const std::chrono::duration<Rep, Period> blockTime)	{return setPeriod(convertToTicks(newPeriod), convertToTicks(blockTime));};
+	template <typename Rep, typename Period>
+	bool setPeriod(const std::chrono::duration<Rep, Period> newPeriod)						{return setPeriod(convertToTicks(newPeriod));};
+
+	bool setPeriodFromISR(TickType_t newPeriod, BaseType_t *higherPriorityTaskWoken);
+	bool setPeriodFromISR(TickType_t newPeriod);
+	template <typename Rep, typename Period>
+	bool setPeriodFromISR(const std::chrono::duration<Rep, Period> newPeriod, BaseType_t *higherPriorityTaskWoken)	{return setPeriodFromISR(convertToTicks(newPeriod), higherPriorityTaskWoken);};
+	template <typename Rep, typename Period>
+	bool setPeriodFromISR(const std::chrono::duration<Rep, Period> newPeriod)				{return setPeriodFromISR(convertToTicks(newPeriod));};
 
 	TickType_t getPeriod(void);
 
+	TickType_t getExpiryTime(void);
+
+	void setReloadMode(bool autoReload);
+	bool getReloadMode(void);
+
 	void setID(int newID);
 	int getID(void);
 
-	std::string getName(void);
+	const char *getName(void);
 
 	void setDefaultBlockTime(TickType_t newBlockTime);
+	template <typename Rep, typename Period>
+	void setDefaultBlockTime(const std::chrono::duration<Rep, Period> newBlockTime)			{setDefaultBlockTime(convertToTicks(newBlockTime));};
 	TickType_t getDefaultBlockTime(void);
 };
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+class TimerStatic : public Timer
+{
+protected:
+	StaticTimer_t					timerBuffer;
+
+public:
+	TimerStatic(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc);
+	TimerStatic(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc);
+};
+#endif
+
+#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
 /**
  * @brief		Constructor
  *
@@ -101,11 +161,12 @@ public:
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
  ****************************************************************************/
-inline Timer::Timer(std::string timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc)
-			:	name(timerName),
-				callbackFunc(timerCallbackFunc)
+inline Timer::Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc)
+			:	callbackFunc(timerCallbackFunc)
 {
-	handle = xTimerCreate(name.c_str(), timerPeriod, (int) timerAutoReload, (void *) timerID, callbackFunc);
+	copyName(name, sizeof(name), timerName);
+
+	handle = xTimerCreate(name, timerPeriod, (int) timerAutoReload, (void *) (intptr_t) timerID, callbackFunc);
 
 	assert(handle != NULL);
 };
@@ -125,14 +186,88 @@ inline Timer::Timer(std::string timerName, TickType_t timerPeriod, bool timerAut
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
  ****************************************************************************/
-inline Timer::Timer(std::string timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc)
-			:	name(timerName),
-				callbackFunc(timerCallbackFunc)
+inline Timer::Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc)
+			:	callbackFunc(timerCallbackFunc)
 {
-	handle = xTimerCreate(name.c_str(), timerPeriod, (int) timerAutoReload, (void *) 0, callbackFunc);
+	copyName(name, sizeof(name), timerName);
+
+	handle = xTimerCreate(name, timerPeriod, (int) timerAutoReload, (void *) 0, callbackFunc);
 
 	assert(handle != NULL);
 };
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief		Constructor, with static memory
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerID				An identifier that is assigned to the timer
+ * @param		timerCallbackFunc	The function to call when the timer expires
+ * @param		timerBuffer			Used to hold the timer's data structure
+ *
+ * @details		Constructs a new timer object with the FreeRTOS API function
+ * 				xTimerCreateStatic(). No memory is allocated from the FreeRTOS
+ * 				heap, the buffer must exist as long as the timer exists.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline Timer::Timer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc, StaticTimer_t *timerBuffer)
+			:	callbackFunc(timerCallbackFunc)
+{
+	copyName(name, sizeof(name), timerName);
+
+	handle = xTimerCreateStatic(name, timerPeriod, (int) timerAutoReload, (void *) (intptr_t) timerID, callbackFunc, timerBuffer);
+
+	assert(handle != NULL);
+};
+
+/**
+ * @brief		Constructor, static timer
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerID				An identifier that is assigned to the timer
+ * @param		timerCallbackFunc	The function to call when the timer expires
+ *
+ * @details		Constructs a new timer object with the FreeRTOS API function
+ * 				xTimerCreateStatic(). The timer structure is a member of the
+ * 				object, so nothing is allocated at runtime.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline TimerStatic::TimerStatic(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, int timerID, TimerCallbackFunction_t timerCallbackFunc)
+			:	Timer(timerName, timerPeriod, timerAutoReload, timerID, timerCallbackFunc, &timerBuffer)
+{
+};
+
+/**
+ * @brief		Constructor, static timer (default ID = 0)
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerCallbackFunc	The function to call when the timer expires
+ *
+ * @details		Constructs a new timer object with the FreeRTOS API function
+ * 				xTimerCreateStatic() with an default timerID of 0.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline TimerStatic::TimerStatic(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, TimerCallbackFunction_t timerCallbackFunc)
+			:	Timer(timerName, timerPeriod, timerAutoReload, 0, timerCallbackFunc, &timerBuffer)
+{
+};
+#endif
 
 /**
  * @brief		Destructor
@@ -184,10 +319,19 @@ inline bool Timer::isActive(void)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Timer::start(TickType_t blockTime)
 {
-	return (xTimerStart(handle, blockTime) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, timerStart);
+	ret = (xTimerStart(handle, blockTime) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, timerStart, ret);
+
+	return ret;
 }
 
 /**
@@ -213,6 +357,51 @@ inline bool Timer::start(void)
 	return Timer::start(defaultBlockTime);
 }
 
+/**
+ * @brief		Starts the timer from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the start command to the timer service task
+ * 				from an interrupt service routine, without blocking. If the
+ * 				timer service task has a higher priority than the interrupted
+ * 				task, `higherPriorityTaskWoken` is set to pdTRUE and a context
+ * 				switch should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object.
+ * @warning		False is returned if the timer command queue is full.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerStartFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::startFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	return (xTimerStartFromISR(handle, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Starts the timer from ISR
+ *
+ * @param		void
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the start command to the timer service task
+ * 				from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. The timer service task has to
+ * 				wait for the next tick to run, use the overloaded method to
+ * 				avoid that.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerStartFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::startFromISR(void)
+{
+	return Timer::startFromISR(NULL);
+}
+
 /**
  * @brief		Stops the timer, with the given block time
  *
@@ -225,10 +414,19 @@ inline bool Timer::start(void)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Timer::stop(TickType_t blockTime)
 {
-	return (xTimerStop(handle, blockTime) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, timerStop);
+	ret = (xTimerStop(handle, blockTime) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, timerStop, ret);
+
+	return ret;
 }
 
 /**
@@ -254,6 +452,51 @@ inline bool Timer::stop(void)
 	return Timer::stop(defaultBlockTime);
 }
 
+/**
+ * @brief		Stops the timer from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the stop command to the timer service task
+ * 				from an interrupt service routine, without blocking. If the
+ * 				timer service task has a higher priority than the interrupted
+ * 				task, `higherPriorityTaskWoken` is set to pdTRUE and a context
+ * 				switch should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object.
+ * @warning		False is returned if the timer command queue is full.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerStopFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::stopFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	return (xTimerStopFromISR(handle, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Stops the timer from ISR
+ *
+ * @param		void
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the stop command to the timer service task
+ * 				from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. The timer service task has to
+ * 				wait for the next tick to run, use the overloaded method to
+ * 				avoid that.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerStopFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::stopFromISR(void)
+{
+	return Timer::stopFromISR(NULL);
+}
+
 /**
  * @brief		Resets the timer, with the given block time
  *
@@ -266,10 +509,19 @@ inline bool Timer::stop(void)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Timer::reset(TickType_t blockTime)
 {
-	return (xTimerReset(handle, blockTime) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, timerReset);
+	ret = (xTimerReset(handle, blockTime) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, timerReset, ret);
+
+	return ret;
 }
 
 /**
@@ -295,6 +547,52 @@ inline bool Timer::reset(void)
 	return Timer::reset(defaultBlockTime);
 }
 
+/**
+ * @brief		Resets the timer from ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the reset command to the timer service task
+ * 				from an interrupt service routine, without blocking, e.g. to
+ * 				re-arm a timeout on every received byte. If the timer service
+ * 				task has a higher priority than the interrupted task,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE and a context switch
+ * 				should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object.
+ * @warning		False is returned if the timer command queue is full.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerResetFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::resetFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	return (xTimerResetFromISR(handle, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Resets the timer from ISR
+ *
+ * @param		void
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the reset command to the timer service task
+ * 				from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. The timer service task has to
+ * 				wait for the next tick to run, use the overloaded method to
+ * 				avoid that.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerResetFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::resetFromISR(void)
+{
+	return Timer::resetFromISR(NULL);
+}
+
 /**
  * @brief		Sets the period of the timer, with the given block time
  *
@@ -309,10 +607,19 @@ inline bool Timer::reset(void)
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Records enter, exit and timeout
+ * 									for the optional trace
  ****************************************************************************/
 inline bool Timer::setPeriod(TickType_t newPeriod, TickType_t blockTime)
 {
-	return (xTimerChangePeriod(handle, newPeriod, blockTime) == pdTRUE) ? true : false;
+	bool ret; // Temporary return value
+
+	WRAPPER_TRACE_ENTER(handle, timerSetPeriod);
+	ret = (xTimerChangePeriod(handle, newPeriod, blockTime) == pdTRUE) ? true : false;
+	WRAPPER_TRACE_EXIT(handle, timerSetPeriod, ret);
+
+	return ret;
 }
 
 /**
@@ -338,6 +645,53 @@ inline bool Timer::setPeriod(TickType_t newPeriod)
 	return Timer::setPeriod(newPeriod, defaultBlockTime);
 }
 
+/**
+ * @brief		Sets the period of the timer from ISR
+ *
+ * @param		newPeriod					New period in ticks
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the change period command to the timer
+ * 				service task from an interrupt service routine, without
+ * 				blocking. A dormant timer is started by it. If the timer
+ * 				service task has a higher priority than the interrupted task,
+ * 				`higherPriorityTaskWoken` is set to pdTRUE and a context switch
+ * 				should be requested before the ISR exits, e.g. with an
+ * 				`IsrContext` object.
+ * @warning		False is returned if the timer command queue is full.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerChangePeriodFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::setPeriodFromISR(TickType_t newPeriod, BaseType_t *higherPriorityTaskWoken)
+{
+	return (xTimerChangePeriodFromISR(handle, newPeriod, higherPriorityTaskWoken) == pdPASS) ? true : false;
+}
+
+/**
+ * @brief		Sets the period of the timer from ISR
+ *
+ * @param		newPeriod		New period in ticks
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		This function sends the change period command to the timer
+ * 				service task from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`. The timer service task has to
+ * 				wait for the next tick to run, use the overloaded method to
+ * 				avoid that.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerChangePeriodFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::setPeriodFromISR(TickType_t newPeriod)
+{
+	return Timer::setPeriodFromISR(newPeriod, NULL);
+}
+
 /**
  * @brief		Gets the period of the timer
  *
@@ -356,6 +710,60 @@ inline TickType_t Timer::getPeriod(void)
 	return xTimerGetPeriod(handle);
 }
 
+/**
+ * @brief		Gets the expiry time of the timer
+ *
+ * @param		void
+ * @return		The tick count when the timer expires
+ *
+ * @details		This function gets the tick count at which the timer will
+ * 				expire. The value is undefined if the timer is dormant, check
+ * 				with `isActive()`. Subtract xTaskGetTickCount() to get the
+ * 				remaining time, the difference wraps correctly.
+ * @see			https://www.freertos.org/FreeRTOS-timers-xTimerGetExpiryTime.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline TickType_t Timer::getExpiryTime(void)
+{
+	return xTimerGetExpiryTime(handle);
+}
+
+/**
+ * @brief		Sets the reload mode of the timer
+ *
+ * @param		autoReload		True for an auto reload timer, false for a one shot timer
+ * @return		void
+ *
+ * @details		This function changes the timer between auto reload and one
+ * 				shot, without restarting it.
+ * @see			https://www.freertos.org/FreeRTOS-Timers-vTimerSetReloadMode.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Timer::setReloadMode(bool autoReload)
+{
+	vTimerSetReloadMode(handle, (autoReload == true) ? pdTRUE : pdFALSE);
+}
+
+/**
+ * @brief		Gets the reload mode of the timer
+ *
+ * @param		void
+ * @return		True for an auto reload timer, false for a one shot timer
+ *
+ * @see			https://www.freertos.org/xTimerGetReloadMode.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline bool Timer::getReloadMode(void)
+{
+	return (xTimerGetReloadMode(handle) == pdTRUE) ? true : false;
+}
+
 /**
  * @brief		Sets the id of the timer
  *
@@ -370,7 +778,7 @@ inline TickType_t Timer::getPeriod(void)
  ****************************************************************************/
 inline void Timer::setID(int newID)
 {
-	vTimerSetTimerID(handle, (void *) newID);
+	vTimerSetTimerID(handle, (void *) (intptr_t) newID);
 }
 
 /**
@@ -387,7 +795,7 @@ inline void Timer::setID(int newID)
  ****************************************************************************/
 inline int Timer::getID(void)
 {
-	return (int) pvTimerGetTimerID(handle);
+	return (int) (intptr_t) pvTimerGetTimerID(handle);
 }
 
 /**
@@ -396,13 +804,17 @@ inline int Timer::getID(void)
  * @param		void
  * return		Returns the name of the timer
  *
- * @details		This function gets the name of the timer from the class,
- * 				not the timer struc of FreeRTOS.
+ * @details		This function gets the name of the timer from the timer
+ * 				struct of FreeRTOS, no copy of the name is made.
+ * @see			https://www.freertos.org/FreeRTOS-timers-pcTimerGetName.html
  *
  * @author		N. Zoller (NZ)
  * @date		10.04.2023	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Returns a pointer to the name
+ * 									instead of a std::string
  ****************************************************************************/
-inline std::string Timer::getName(void)
+inline const char *Timer::getName(void)
 {
 	return pcTimerGetName(handle);
 }
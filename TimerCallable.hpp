@@ -0,0 +1,209 @@
+#ifndef TIMERCALLABLE_HPP_
+#define TIMERCALLABLE_HPP_
+/****************************************************************************/
+/*  Header    : Timer Callable Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : TimerCallable.hpp											*/
+/*                                                                          */
+/*  @brief	  : Timers that call a member function or a callable, both		*/
+/*				without std::function and without heap						*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <FreeRTOS.h>
+#include <timers.h>
+
+#include "Timer.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename T, void (T::*Method)(void)>
+class TimerMember : public TimerStatic
+{
+protected:
+	void static callback(TimerHandle_t timer);
+
+public:
+	TimerMember(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, T &timerObject);
+
+	TimerMember(const TimerMember &) = delete;
+	TimerMember &operator=(const TimerMember &) = delete;
+};
+
+/* Class definition            */
+template <typename Callable>
+class TimerCallableStorage
+{
+protected:
+	Callable						callable;
+
+	TimerCallableStorage(Callable &&timerCallable): callable(std::move(timerCallable)) {};
+	TimerCallableStorage(const Callable &timerCallable): callable(timerCallable) {};
+};
+
+/* Class definition            */
+template <typename Callable>
+class TimerCallable : protected TimerCallableStorage<Callable>, public TimerStatic
+{
+	static_assert(std::is_invocable_v<Callable &>, "Callable must be invocable without arguments");
+
+protected:
+	void static callback(TimerHandle_t timer);
+
+public:
+	template <typename C>
+	TimerCallable(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, C &&timerCallable);
+
+	TimerCallable(const TimerCallable &) = delete;
+	TimerCallable &operator=(const TimerCallable &) = delete;
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerObject			Object whose `Method` is called when the timer expires
+ *
+ * @details		Creates a static timer that calls `timerObject.*Method()` in
+ * 				the timer service task, e.g.
+ * 				`TimerMember<Protocol, &Protocol::onTimeout> timeout("to", 10, false, *this);`.
+ * 				The member function is a template parameter, so the
+ * 				trampoline callback() is generated per method and the call is
+ * 				direct. The timer ID holds the pointer to the object, it is set
+ * 				before the timer can be started.
+ * @warning		Don't change the ID with setID(), the callback needs it.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, void (T::*Method)(void)>
+inline TimerMember<T, Method>::TimerMember(	std::string_view timerName,
+											TickType_t timerPeriod,
+											bool timerAutoReload,
+											T &timerObject)
+											:	TimerStatic(timerName, timerPeriod, timerAutoReload, &TimerMember::callback)
+{
+	vTimerSetTimerID(handle, (void *) &timerObject);
+}
+
+/**
+ * @brief		Timer callback function
+ *
+ * @param		timer			Handle of the expired timer
+ * @return		void
+ *
+ * @details		Gets the object from the timer ID and calls the member
+ * 				function. Runs in the timer service task, so it must not block.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, void (T::*Method)(void)>
+inline void TimerMember<T, Method>::callback(TimerHandle_t timer)
+{
+	(static_cast<T *>(pvTimerGetTimerID(timer))->*Method)();
+}
+
+/**
+ * @brief		Constructor
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerCallable		Callable without arguments, called when the timer expires
+ *
+ * @details		Stores the callable inside the object and creates a static
+ * 				timer that invokes it in the timer service task. The timer ID
+ * 				holds the pointer to the storage, it is set before the timer
+ * 				can be started. Use makeTimer() to deduce `Callable` from a
+ * 				lambda.
+ * @warning		Don't change the ID with setID(), the callback needs it.
+ * @see			https://www.freertos.org/xTimerCreateStatic.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Callable>
+template <typename C>
+inline TimerCallable<Callable>::TimerCallable(	std::string_view timerName,
+												TickType_t timerPeriod,
+												bool timerAutoReload,
+												C &&timerCallable)
+												:	TimerCallableStorage<Callable>(std::forward<C>(timerCallable)),
+													TimerStatic(timerName, timerPeriod, timerAutoReload, &TimerCallable::callback)
+{
+	vTimerSetTimerID(handle, static_cast<TimerCallableStorage<Callable> *>(this));
+}
+
+/**
+ * @brief		Timer callback function
+ *
+ * @param		timer			Handle of the expired timer
+ * @return		void
+ *
+ * @details		Gets the storage from the timer ID and invokes the callable.
+ * 				Runs in the timer service task, so it must not block.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename Callable>
+inline void TimerCallable<Callable>::callback(TimerHandle_t timer)
+{
+	static_cast<TimerCallable *>(static_cast<TimerCallableStorage<Callable> *>(pvTimerGetTimerID(timer)))->callable();
+}
+
+/**
+ * @brief		Creates a timer from a callable
+ *
+ * @param		timerName			A human readable text name for the timer
+ * @param		timerPeriod			Period of the timer in ticks
+ * @param		timerAutoReload		Set to true the timer will auto reload it self
+ * @param		timerCallable		Callable without arguments, called when the timer expires
+ * @return		The timer object
+ *
+ * @details		Deduces the type of the callable, e.g.
+ * 				`auto blink = makeTimer("blink", 500, true, [&] { led.toggle(); });`.
+ * 				The object is constructed in place (guaranteed copy elision),
+ * 				it is never copied or moved.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename C>
+inline TimerCallable<std::decay_t<C>> makeTimer(std::string_view timerName, TickType_t timerPeriod, bool timerAutoReload, C &&timerCallable)
+{
+	return TimerCallable<std::decay_t<C>>(timerName, timerPeriod, timerAutoReload, std::forward<C>(timerCallable));
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Timer Callable Class										*/
+/****************************************************************************/
+#endif /* TIMERCALLABLE_HPP_ */
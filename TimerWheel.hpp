@@ -0,0 +1,449 @@
+#ifndef TIMERWHEEL_HPP_
+#define TIMERWHEEL_HPP_
+/****************************************************************************/
+/*  Header    : Timer Wheel Class											*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : TimerWheel.hpp												*/
+/*                                                                          */
+/*  @brief	  : Hashed timing wheel for many short software timers, driven	*/
+/*				by one ISR or one task										*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+#include <cstddef>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+/* Class definition            */
+class TimerWheelEntry
+{
+	template <size_t Slots>
+	friend class TimerWheel;
+
+protected:
+	TimerWheelEntry					*next = NULL;
+	TimerWheelEntry					*previous = NULL;
+	TickType_t						expiry = 0;
+	TickType_t						timeout;
+	bool							autoReload;
+	bool							active = false;
+
+	void							(*const callbackFunc)(void *context);
+	void							*const context;
+
+public:
+	TimerWheelEntry(TickType_t timerTimeout, bool timerAutoReload, void (*timerCallbackFunc)(void *context), void *timerContext)
+		: timeout(timerTimeout), autoReload(timerAutoReload), callbackFunc(timerCallbackFunc), context(timerContext) {};
+
+	TimerWheelEntry(const TimerWheelEntry &) = delete;
+	TimerWheelEntry &operator=(const TimerWheelEntry &) = delete;
+
+	bool isActive(void)														{return active;};
+
+	TickType_t getTimeout(void)												{return timeout;};
+
+	TickType_t getExpiryTime(void)											{return expiry;};
+};
+
+/* Class definition            */
+template <size_t Slots>
+class TimerWheel : public FreeRTOS
+{
+	static_assert((Slots != 0) && ((Slots & (Slots - 1)) == 0), "Slots must be a power of two");
+
+protected:
+	TimerWheelEntry					*slots[Slots] = {};
+	TickType_t						time = 0;
+
+	void link(TimerWheelEntry &timer, TickType_t expiry);
+	void unlink(TimerWheelEntry &timer);
+
+	void startInCritical(TimerWheelEntry &timer, TickType_t timeout);
+	void stopInCritical(TimerWheelEntry &timer);
+
+	TimerWheelEntry *expireInCritical(TickType_t now, void (*&callbackFunc)(void *context), void *&context);
+
+public:
+	TimerWheel(void) {};
+
+	void start(TimerWheelEntry &timer);
+	void start(TimerWheelEntry &timer, TickType_t newTimeout);
+	template <typename Rep, typename Period>
+	void start(TimerWheelEntry &timer, const std::chrono::duration<Rep, Period> newTimeout)	{start(timer, convertToTicks(newTimeout));};
+
+	void startFromISR(TimerWheelEntry &timer);
+	void startFromISR(TimerWheelEntry &timer, TickType_t newTimeout);
+
+	void stop(TimerWheelEntry &timer);
+
+	void stopFromISR(TimerWheelEntry &timer);
+
+	void tick(void);
+
+	void tickFromISR(void);
+
+	TickType_t getTime(void)												{return time;};
+};
+
+/**
+ * @brief		Inserts a timer into its slot
+ *
+ * @param		timer			Timer to insert, not in any slot
+ * @param		expiry			Wheel time when the timer expires
+ * @return		void
+ *
+ * @details		The slot is the expiry time modulo `Slots`, so timers further
+ * 				away than one turn share the slot with nearer ones and are
+ * 				skipped until their turn. Must be called in a critical section.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::link(TimerWheelEntry &timer, TickType_t expiry)
+{
+	TimerWheelEntry *&head = slots[expiry & (Slots - 1)]; // First timer of the slot
+
+	timer.expiry = expiry;
+	timer.previous = NULL;
+	timer.next = head;
+
+	if (head != NULL) {
+		head->previous = &timer;
+	}
+
+	head = &timer;
+	timer.active = true;
+}
+
+/**
+ * @brief		Removes a timer from its slot
+ *
+ * @param		timer			Active timer to remove
+ * @return		void
+ *
+ * @details		The list is doubly linked, so removing is O(1). Must be called
+ * 				in a critical section.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::unlink(TimerWheelEntry &timer)
+{
+	if (timer.previous != NULL) {
+		timer.previous->next = timer.next;
+	} else {
+		slots[timer.expiry & (Slots - 1)] = timer.next;
+	}
+
+	if (timer.next != NULL) {
+		timer.next->previous = timer.previous;
+	}
+
+	timer.next = NULL;
+	timer.previous = NULL;
+	timer.active = false;
+}
+
+/**
+ * @brief		Starts or restarts a timer, in a critical section
+ *
+ * @param		timer			Timer to start
+ * @param		timeout			Ticks of the wheel until the timer expires
+ * @return		void
+ *
+ * @details		A timeout of 0 expires with the next tick.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::startInCritical(TimerWheelEntry &timer, TickType_t timeout)
+{
+	if (timer.active == true) {
+		unlink(timer);
+	}
+
+	timer.timeout = timeout;
+	link(timer, time + ((timeout == 0) ? 1 : timeout));
+}
+
+/**
+ * @brief		Stops a timer, in a critical section
+ *
+ * @param		timer			Timer to stop
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::stopInCritical(TimerWheelEntry &timer)
+{
+	if (timer.active == true) {
+		unlink(timer);
+	}
+}
+
+/**
+ * @brief		Removes the next expired timer, in a critical section
+ *
+ * @param		now				Current wheel time
+ * @param		callbackFunc	Set to the callback of the expired timer
+ * @param		context			Set to the context of the expired timer
+ * @return		The expired timer, NULL if there is none left
+ *
+ * @details		Searches the slot of `now` for a timer that expires now. An
+ * 				auto reload timer is linked again with its timeout, all
+ * 				others are stopped. The callback is returned, so it can be
+ * 				called after the critical section.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline TimerWheelEntry *TimerWheel<Slots>::expireInCritical(TickType_t now, void (*&callbackFunc)(void *context), void *&context)
+{
+	TimerWheelEntry *timer = slots[now & (Slots - 1)]; // Candidate in the slot
+
+	while ((timer != NULL) && (timer->expiry != now)) {
+		timer = timer->next;
+	}
+
+	if (timer != NULL) {
+		unlink(*timer);
+
+		if (timer->autoReload == true) {
+			link(*timer, now + ((timer->timeout == 0) ? 1 : timer->timeout));
+		}
+
+		callbackFunc = timer->callbackFunc;
+		context = timer->context;
+	}
+
+	return timer;
+}
+
+/**
+ * @brief		Starts or restarts a timer with its timeout
+ *
+ * @param		timer			Timer to start
+ * @return		void
+ *
+ * @details		Restarting a running timer, e.g. a comm timeout on every
+ * 				received byte, is just an unlink and a link in a short
+ * 				critical section. No command is sent to the timer service
+ * 				task and nothing blocks.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::start(TimerWheelEntry &timer)
+{
+	TimerWheel<Slots>::start(timer, timer.timeout);
+}
+
+/**
+ * @brief		Starts or restarts a timer with a new timeout
+ *
+ * @param		timer			Timer to start
+ * @param		newTimeout		Ticks of the wheel until the timer expires, also
+ * 								used as period of an auto reload timer
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::start(TimerWheelEntry &timer, TickType_t newTimeout)
+{
+	taskENTER_CRITICAL();
+	startInCritical(timer, newTimeout);
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Starts or restarts a timer with its timeout from ISR
+ *
+ * @param		timer			Timer to start
+ * @return		void
+ *
+ * @details		Like start(), callable from an interrupt service routine up
+ * 				to configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::startFromISR(TimerWheelEntry &timer)
+{
+	TimerWheel<Slots>::startFromISR(timer, timer.timeout);
+}
+
+/**
+ * @brief		Starts or restarts a timer with a new timeout from ISR
+ *
+ * @param		timer			Timer to start
+ * @param		newTimeout		Ticks of the wheel until the timer expires
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::startFromISR(TimerWheelEntry &timer, TickType_t newTimeout)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	startInCritical(timer, newTimeout);
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Stops a timer
+ *
+ * @param		timer			Timer to stop
+ * @return		void
+ *
+ * @details		Stopping a timer that is not active has no effect.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::stop(TimerWheelEntry &timer)
+{
+	taskENTER_CRITICAL();
+	stopInCritical(timer);
+	taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief		Stops a timer from ISR
+ *
+ * @param		timer			Timer to stop
+ * @return		void
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::stopFromISR(TimerWheelEntry &timer)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	stopInCritical(timer);
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+}
+
+/**
+ * @brief		Advances the wheel by one tick
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Called by the one task that drives the wheel, e.g. from the
+ * 				cycle of a PeriodicTask. Only the slot of the new time is
+ * 				looked at, so the cost of a tick depends on the timers in
+ * 				that slot and not on the total number of timers. The expired
+ * 				timers are removed one by one in short critical sections and
+ * 				their callbacks are called outside, in the driving task.
+ * 				Choose `Slots` larger than the typical timeout, so most timers
+ * 				expire in their first turn.
+ * @warning		Only one task or ISR may drive the wheel.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::tick(void)
+{
+	TickType_t now; // Wheel time of this tick
+	TimerWheelEntry *timer; // Expired timer
+	void (*callbackFunc)(void *context) = NULL; // Callback of the expired timer
+	void *context = NULL; // Context of the expired timer
+
+	taskENTER_CRITICAL();
+	now = ++time;
+	taskEXIT_CRITICAL();
+
+	do {
+		taskENTER_CRITICAL();
+		timer = expireInCritical(now, callbackFunc, context);
+		taskEXIT_CRITICAL();
+
+		if (timer != NULL) {
+			callbackFunc(context);
+		}
+	} while (timer != NULL);
+}
+
+/**
+ * @brief		Advances the wheel by one tick from ISR
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Like tick(), called by the one hardware timer ISR that drives
+ * 				the wheel. The callbacks run in the ISR, so they must only use
+ * 				FromISR methods and be short.
+ * @warning		Only one task or ISR may drive the wheel.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <size_t Slots>
+inline void TimerWheel<Slots>::tickFromISR(void)
+{
+	UBaseType_t savedInterruptStatus; // Interrupt mask before the critical section
+	TickType_t now; // Wheel time of this tick
+	TimerWheelEntry *timer; // Expired timer
+	void (*callbackFunc)(void *context) = NULL; // Callback of the expired timer
+	void *context = NULL; // Context of the expired timer
+
+	savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+	now = ++time;
+	taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+
+	do {
+		savedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		timer = expireInCritical(now, callbackFunc, context);
+		taskEXIT_CRITICAL_FROM_ISR(savedInterruptStatus);
+
+		if (timer != NULL) {
+			callbackFunc(context);
+		}
+	} while (timer != NULL);
+}
+
+/****************************************************************************/
+/* End Header : Timer Wheel Class											*/
+/****************************************************************************/
+#endif /* TIMERWHEEL_HPP_ */
@@ -0,0 +1,630 @@
+#ifndef TOPIC_HPP_
+#define TOPIC_HPP_
+/****************************************************************************/
+/*  Header    : Topic Class													*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : Topic.hpp													*/
+/*                                                                          */
+/*  @brief	  : Publish/subscribe of samples, stored once in a shared ring	*/
+/*				and read by every subscriber with its own cursor			*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/* 				- none														*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "CriticalSection.hpp"
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+enum class TopicOverflow {
+	dropOldest,	///< A slow subscriber loses its oldest samples
+	dropNewest	///< New samples are not published while the subscriber is full
+};
+
+/* Class data declaration      */
+
+/* Class definition            */
+template <typename T, size_t Depth, size_t MaxSubscribers = 8, UBaseType_t NotifyIndex = FREERTOS_WAKEUP_NOTIFY_INDEX>
+class Topic : public FreeRTOS
+{
+	static_assert((Depth >= 2) && ((Depth & (Depth - 1)) == 0), "Depth must be a power of two");
+	static_assert(MaxSubscribers != 0, "MaxSubscribers must not be 0");
+	static_assert(NotifyIndex < configTASK_NOTIFICATION_ARRAY_ENTRIES, "NotifyIndex out of range");
+	static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+public:
+	class Subscriber
+	{
+	protected:
+		Topic							&topic;
+		const TopicOverflow				overflow;
+		std::atomic<uint32_t>			cursor{0};
+		std::atomic<TaskHandle_t>		waitingTask{NULL};
+		uint32_t						lost = 0;
+
+		TickType_t			defaultMaxTicksToWait = portMAX_DELAY;
+
+		friend class Topic;
+
+		bool pop(T &item);
+
+		bool wait(TimeOut_t *timeOut, TickType_t *ticksToWait);
+
+	public:
+		Subscriber(Topic &subscriberTopic, TopicOverflow subscriberOverflow = TopicOverflow::dropOldest);
+
+		~Subscriber(void);
+
+		Subscriber(const Subscriber &) = delete;
+		Subscriber &operator=(const Subscriber &) = delete;
+
+		T receive(TickType_t ticksToWait);
+		template <typename Rep, typename Period>
+		T receive(const std::chrono::duration<Rep, Period> timeToWait)					{return receive(convertToTicks(timeToWait));};
+		T receive(void);
+
+		bool tryReceive(T &item, TickType_t ticksToWait);
+		template <typename Rep, typename Period>
+		bool tryReceive(T &item, const std::chrono::duration<Rep, Period> timeToWait)	{return tryReceive(item, convertToTicks(timeToWait));};
+		bool tryReceive(T &item);
+
+		UBaseType_t messagesWaiting(void);
+
+		uint32_t getLost(void)													{return lost;};
+
+		void setDefaultMaxTicksToWait(TickType_t newTicksToWait);
+		template <typename Rep, typename Period>
+		void setDefaultMaxTicksToWait(const std::chrono::duration<Rep, Period> newTimeToWait)	{setDefaultMaxTicksToWait(convertToTicks(newTimeToWait));};
+	};
+
+protected:
+	struct Slot {
+		std::atomic<uint32_t>		sequence{0};	///< Odd while written, even when complete
+		T							item;
+	};
+
+	Slot							slots[Depth];
+	std::atomic<uint32_t>			writeSequence{0};
+	std::atomic<Subscriber *>		subscribers[MaxSubscribers] = {};
+	uint32_t						dropped = 0;
+
+	bool isBlocked(uint32_t sequence);
+
+	void write(const T &item, uint32_t sequence);
+	bool read(uint32_t sequence, T &item);
+
+	void notify(bool fromISR, BaseType_t *higherPriorityTaskWoken);
+
+public:
+	Topic(void) {};
+
+	Topic(const Topic &) = delete;
+	Topic &operator=(const Topic &) = delete;
+
+	bool publish(const T &item);
+
+	bool publishFromISR(const T &item, BaseType_t *higherPriorityTaskWoken);
+	bool publishFromISR(const T &item);
+
+	uint32_t getPublished(void)												{return writeSequence.load(std::memory_order_relaxed);};
+
+	uint32_t getDropped(void)												{return dropped;};
+};
+
+/**
+ * @brief		Checks if a subscriber holds the slot of the next sample
+ *
+ * @param		sequence		Number of the next sample
+ * @return		True if a `dropNewest` subscriber hasn't read the oldest sample
+ *
+ * @details		A `dropOldest` subscriber never blocks the topic, it loses
+ * 				samples instead.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::isBlocked(uint32_t sequence)
+{
+	Subscriber *subscriber; // Subscriber of the current slot
+
+	for (size_t i = 0; i < MaxSubscribers; i++) {
+		subscriber = subscribers[i].load(std::memory_order_acquire);
+
+		if ((subscriber != NULL) && (subscriber->overflow == TopicOverflow::dropNewest)
+			&& ((sequence - subscriber->cursor.load(std::memory_order_acquire)) >= Depth)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief		Writes a sample into its slot
+ *
+ * @param		item			Sample to write
+ * @param		sequence		Number of the sample
+ * @return		void
+ *
+ * @details		The slot is guarded like a seqlock. Its sequence is odd while
+ * 				the item is copied and set to the even value of the sample
+ * 				afterwards, so a reader detects a sample overwritten during
+ * 				its copy. The sample is published with the write sequence,
+ * 				with release semantics.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline void Topic<T, Depth, MaxSubscribers, NotifyIndex>::write(const T &item, uint32_t sequence)
+{
+	Slot &slot = slots[sequence & (Depth - 1)];
+
+	slot.sequence.store((sequence * 2) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.item = item;
+
+	slot.sequence.store((sequence * 2) + 2, std::memory_order_release);
+	writeSequence.store(sequence + 1, std::memory_order_release);
+}
+
+/**
+ * @brief		Reads a sample from its slot
+ *
+ * @param		sequence		Number of the sample
+ * @param		item			Buffer to store the sample in
+ * @return		True if the sample was read, false if it was overwritten
+ *
+ * @details		Copies the item and checks the sequence of the slot before and
+ * 				after the copy. If it changed, the copy may be torn and is
+ * 				discarded.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::read(uint32_t sequence, T &item)
+{
+	Slot &slot = slots[sequence & (Depth - 1)];
+	uint32_t expected = (sequence * 2) + 2; // Sequence of the complete sample
+
+	if (slot.sequence.load(std::memory_order_acquire) != expected) {
+		return false;
+	}
+
+	item = slot.item;
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	return (slot.sequence.load(std::memory_order_relaxed) == expected) ? true : false;
+}
+
+/**
+ * @brief		Wakes all subscribers waiting for a sample
+ *
+ * @param		fromISR						True if called from an interrupt service routine
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Only subscribers that announced a waiting task are notified,
+ * 				so a publish costs one notification per blocked subscriber.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline void Topic<T, Depth, MaxSubscribers, NotifyIndex>::notify(bool fromISR, BaseType_t *higherPriorityTaskWoken)
+{
+	Subscriber *subscriber; // Subscriber of the current slot
+	TaskHandle_t waiting; // Task waiting on the subscriber
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	for (size_t i = 0; i < MaxSubscribers; i++) {
+		subscriber = subscribers[i].load(std::memory_order_acquire);
+
+		if (subscriber == NULL) {
+			continue;
+		}
+
+		waiting = subscriber->waitingTask.load(std::memory_order_relaxed);
+
+		if (waiting == NULL) {
+			continue;
+		}
+
+		if (fromISR == true) {
+			vTaskNotifyGiveIndexedFromISR(waiting, NotifyIndex, higherPriorityTaskWoken);
+		} else {
+			xTaskNotifyGiveIndexed(waiting, NotifyIndex);
+		}
+	}
+}
+
+/**
+ * @brief		Publishes a sample to all subscribers
+ *
+ * @param		item			Sample to publish
+ * @return		True if it was published, false if it was dropped
+ *
+ * @details		Copies the sample once into the shared ring, independent of
+ * 				the number of subscribers, and wakes the waiting subscribers
+ * 				with a task notification. It never blocks. A subscriber with
+ * 				`dropOldest` that lags `Depth` samples behind loses its oldest
+ * 				sample. If a subscriber with `dropNewest` would lose one, the
+ * 				new sample is dropped for all subscribers instead and counted
+ * 				in getDropped(). The scheduler is suspended meanwhile, so no
+ * 				subscriber is destroyed while it is notified.
+ * @warning		Only one task or ISR may publish to the topic.
+ * @see			https://www.freertos.org/xTaskNotifyGive.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::publish(const T &item)
+{
+	SchedulerLock lock; // Keeps the subscribers alive
+	uint32_t sequence = writeSequence.load(std::memory_order_relaxed); // Number of the new sample
+
+	if (isBlocked(sequence) == true) {
+		dropped++;
+		return false;
+	}
+
+	write(item, sequence);
+	notify(false, NULL);
+
+	return true;
+}
+
+/**
+ * @brief		Publishes a sample to all subscribers from an ISR
+ *
+ * @param		item						Sample to publish
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was published, false if it was dropped
+ *
+ * @details		Same as publish(), from an interrupt service routine. A
+ * 				subscriber can't be destroyed meanwhile, it is removed in a
+ * 				critical section.
+ * @warning		Only one task or ISR may publish to the topic.
+ * @see			https://www.freertos.org/vTaskNotifyGiveFromISR.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::publishFromISR(const T &item, BaseType_t *higherPriorityTaskWoken)
+{
+	uint32_t sequence = writeSequence.load(std::memory_order_relaxed); // Number of the new sample
+
+	if (isBlocked(sequence) == true) {
+		dropped++;
+		return false;
+	}
+
+	write(item, sequence);
+	notify(true, higherPriorityTaskWoken);
+
+	return true;
+}
+
+/**
+ * @brief		Publishes a sample to all subscribers from an ISR
+ *
+ * @param		item			Sample to publish
+ * @return		True if it was published, false if it was dropped
+ *
+ * @details		Same as publish(), from an interrupt service routine.
+ * @warning		The `pxHigherPriorityTaskWoken` is an optional parameter
+ * 				and is constant set to `NULL`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::publishFromISR(const T &item)
+{
+	return Topic<T, Depth, MaxSubscribers, NotifyIndex>::publishFromISR(item, NULL);
+}
+
+/**
+ * @brief		Constructor, subscribes to the topic
+ *
+ * @param		subscriberTopic			Topic to subscribe to
+ * @param		subscriberOverflow		What is dropped if the subscriber lags `Depth` samples behind
+ *
+ * @details		Takes a free subscriber slot of the topic in a critical
+ * 				section. The subscriber receives the samples published after
+ * 				its construction.
+ * @warning		Asserts if the topic has already `MaxSubscribers` subscribers.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::Subscriber(Topic &subscriberTopic, TopicOverflow subscriberOverflow): topic(subscriberTopic), overflow(subscriberOverflow)
+{
+	bool subscribed = false; // True if a free slot was found
+
+	{
+		CriticalSection section; // Exclusive access to the subscriber slots
+
+		for (size_t i = 0; i < MaxSubscribers; i++) {
+			if (topic.subscribers[i].load(std::memory_order_relaxed) == NULL) {
+				cursor.store(topic.writeSequence.load(std::memory_order_acquire), std::memory_order_relaxed);
+				topic.subscribers[i].store(this, std::memory_order_release);
+				subscribed = true;
+				break;
+			}
+		}
+	}
+
+	assert(subscribed == true);
+}
+
+/**
+ * @brief		Destructor, unsubscribes from the topic
+ *
+ * @details		Frees the subscriber slot in a critical section. A publishing
+ * 				task holds the scheduler lock while it notifies, so the slot
+ * 				is never freed during a publish.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::~Subscriber(void)
+{
+	CriticalSection section; // Exclusive access to the subscriber slots
+
+	for (size_t i = 0; i < MaxSubscribers; i++) {
+		if (topic.subscribers[i].load(std::memory_order_relaxed) == this) {
+			topic.subscribers[i].store(NULL, std::memory_order_release);
+			break;
+		}
+	}
+}
+
+/**
+ * @brief		Reads the next sample of the subscriber
+ *
+ * @param		item			Buffer to store the sample in
+ * @return		True if a sample was read, false if there is no new sample
+ *
+ * @details		If the publisher overtook the cursor, it jumps to the oldest
+ * 				sample in the ring and the skipped samples are counted as
+ * 				lost. A sample overwritten during its copy is lost as well,
+ * 				the subscriber doesn't spin on it, so a preempted publisher of
+ * 				lower priority can't stall it. The cursor is published with
+ * 				release semantics after the copy, so the publisher doesn't
+ * 				overwrite the slot of a `dropNewest` subscriber before.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::pop(T &item)
+{
+	uint32_t current = cursor.load(std::memory_order_relaxed); // Next sample to read
+	uint32_t written; // Number of published samples
+
+	while ((written = topic.writeSequence.load(std::memory_order_acquire)) != current) {
+		if ((written - current) > Depth) {
+			lost += (written - current) - Depth;
+			current = written - Depth;
+		}
+
+		if (topic.read(current, item) == true) {
+			cursor.store(current + 1, std::memory_order_release);
+			return true;
+		}
+
+		lost++;
+		current++;
+	}
+
+	cursor.store(current, std::memory_order_release);
+
+	return false;
+}
+
+/**
+ * @brief		Blocks the calling task until it is notified or the time expired
+ *
+ * @param		timeOut			Time out state, set when the operation started
+ * @param		ticksToWait		Remaining ticks to wait, updated on return
+ * @return		False if the time expired, true otherwise
+ *
+ * @details		Waits for a notification of the publisher. The caller has to
+ * 				check for a sample again after announcing the task, so no
+ * 				notification is lost in between. A notification could also be
+ * 				stale, so the caller retries.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::wait(TimeOut_t *timeOut, TickType_t *ticksToWait)
+{
+	ulTaskNotifyTakeIndexed(NotifyIndex, pdTRUE, *ticksToWait);
+	waitingTask.store(NULL, std::memory_order_relaxed);
+
+	return (xTaskCheckForTimeOut(timeOut, ticksToWait) == pdTRUE) ? false : true;
+}
+
+/**
+ * @brief		Receives a sample and waits the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		The sample
+ *
+ * @details		Reads the next sample of the subscriber. If there is none, the
+ * 				task blocks on a task notification until a sample is published
+ * 				or the time expired.
+ * @warning		Only one task may receive from a subscriber. Like
+ * 				`Queue<T>::receive()` it asserts that a sample was received.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline T Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::receive(TickType_t ticksToWait)
+{
+	T item; // Create local buffer
+	bool ret = tryReceive(item, ticksToWait);
+
+	assert(ret == true);
+
+	return item;
+}
+
+/**
+ * @brief		Receives a sample and waits the default ticks
+ *
+ * @param		void
+ * @return		The sample
+ *
+ * @details		Reads the next sample and waits the default amount of time.
+ * 				The default value is `portMAX_DELAY`, so it waits the maximum
+ * 				of time.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline T Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::receive(void)
+{
+	return receive(defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives a sample into a reference and waits the given ticks
+ *
+ * @param		item			Stores the received sample
+ * @param		ticksToWait		Ticks to wait to complete
+ * @return		True if a sample was received, false if the time expired
+ *
+ * @details		Reads the next sample of the subscriber. If there is none, the
+ * 				task blocks on a task notification until a sample is published
+ * 				or the time expired. On a timeout `item` is not changed.
+ * 				`NotifyIndex` defaults to FREERTOS_WAKEUP_NOTIFY_INDEX, not to
+ * 				index 0 of Task::notifyGive() and the stream buffers.
+ * @warning		Only one task may receive from a subscriber. Tasks waiting on
+ * 				two topics need a separate `NotifyIndex` for each.
+ * @see			https://www.freertos.org/ulTaskNotifyTake.html
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::tryReceive(T &item, TickType_t ticksToWait)
+{
+	TimeOut_t timeOut; // Start time of the receive
+	bool ret = pop(item);
+
+	if ((ret == false) && (ticksToWait != 0)) {
+		vTaskSetTimeOutState(&timeOut);
+
+		while (ret == false) {
+			waitingTask.store(xTaskGetCurrentTaskHandle(), std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			ret = pop(item);
+
+			if (ret == true) {
+				waitingTask.store(NULL, std::memory_order_relaxed);
+			} else if (wait(&timeOut, &ticksToWait) == false) {
+				ret = pop(item);
+				break;
+			} else {
+				ret = pop(item);
+			}
+		}
+	}
+
+	return ret;
+}
+
+/**
+ * @brief		Receives a sample into a reference and waits the default ticks
+ *
+ * @param		item			Stores the received sample
+ * @return		True if a sample was received, false if the time expired
+ *
+ * @details		Reads the next sample and waits the default amount of time.
+ * 				The default value is `portMAX_DELAY`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline bool Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::tryReceive(T &item)
+{
+	return tryReceive(item, defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Return the number of samples the subscriber hasn't read
+ *
+ * @param		void
+ * @return		Number of unread samples, at most `Depth`
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline UBaseType_t Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::messagesWaiting(void)
+{
+	uint32_t waiting = topic.writeSequence.load(std::memory_order_acquire) - cursor.load(std::memory_order_relaxed); // Unread samples
+
+	return (waiting > Depth) ? (UBaseType_t) Depth : (UBaseType_t) waiting;
+}
+
+/**
+ * @brief		Used to set the default max ticks
+ *
+ * @param		newTicksToWait	New value for the `defaultMaxTicksToWait`
+ * @return		void
+ *
+ * @details		Sets the new default ticks used by receive(). The value is
+ * 				initialized to `portMAX_DELAY`.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, size_t Depth, size_t MaxSubscribers, UBaseType_t NotifyIndex>
+inline void Topic<T, Depth, MaxSubscribers, NotifyIndex>::Subscriber::setDefaultMaxTicksToWait(TickType_t newTicksToWait)
+{
+	defaultMaxTicksToWait = newTicksToWait;
+}
+
+/****************************************************************************/
+/* End Header : Topic Class													*/
+/****************************************************************************/
+#endif /* TOPIC_HPP_ */
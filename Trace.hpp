@@ -0,0 +1,246 @@
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+/****************************************************************************/
+/*  Header    : Trace Class													*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : Trace.hpp													*/
+/*                                                                          */
+/*  @brief	  : Optional lock free trace of the wrapper methods				*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/*				- 14.10.2026	NZ	Add: Event group methods				*/
+/*				- 14.10.2026	NZ	Add: Stream and message buffer methods	*/
+/*				- 14.10.2026	NZ	Mod: Uses the shared CycleCounter		*/
+/*				- 14.10.2026	NZ	Fix: Slot reserved with masked			*/
+/*									interrupts on ARMv6-M					*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "CycleCounter.hpp"
+
+/* Class constant declaration  */
+#ifndef configUSE_WRAPPER_TRACE
+#define configUSE_WRAPPER_TRACE			0
+#endif
+
+#if (configUSE_WRAPPER_TRACE == 1)
+#ifndef configWRAPPER_TRACE_LENGTH
+#define configWRAPPER_TRACE_LENGTH		256
+#endif
+
+#ifndef configWRAPPER_TRACE_TIMESTAMP
+#define configWRAPPER_TRACE_TIMESTAMP()	CycleCounter::get()
+#endif
+
+#if defined(configNUMBER_OF_CORES) && (configNUMBER_OF_CORES > 1)
+#define WRAPPER_TRACE_CORES				configNUMBER_OF_CORES
+#define WRAPPER_TRACE_CORE_ID()			portGET_CORE_ID()
+#else
+#define WRAPPER_TRACE_CORES				1
+#define WRAPPER_TRACE_CORE_ID()			0
+#endif
+
+#if defined(__ARM_ARCH_6M__)
+#define WRAPPER_TRACE_ATOMIC_RMW		0	///< No LDREX/STREX, e.g. RP2040
+#else
+#define WRAPPER_TRACE_ATOMIC_RMW		1
+#endif
+
+#define WRAPPER_TRACE_ENTER(object, api)			Trace::record((const void *) (object), TraceApi::api, TraceEvent::enter)
+#define WRAPPER_TRACE_EXIT(object, api, success)	Trace::record((const void *) (object), TraceApi::api, ((success) == true) ? TraceEvent::exit : TraceEvent::timeout)
+#define WRAPPER_TRACE_BLOCK_HOOK_DEFINITION			extern "C" void wrapperTraceBlock(const void *object) {Trace::record(object, TraceApi::kernel, TraceEvent::block);}
+#else
+#define WRAPPER_TRACE_ENTER(object, api)			((void) 0)
+#define WRAPPER_TRACE_EXIT(object, api, success)	((void) 0)
+#define WRAPPER_TRACE_BLOCK_HOOK_DEFINITION
+#endif
+
+/* Class Type declaration      */
+enum class TraceEvent : uint8_t
+{
+	enter,
+	exit,
+	block,
+	timeout
+};
+
+enum class TraceApi : uint8_t
+{
+	kernel,
+	queueSendToBack,
+	queueSendToFront,
+	queueReceive,
+	queuePeek,
+	semaphoreTake,
+	semaphoreGive,
+	mutexTakeRecursive,
+	mutexGiveRecursive,
+	timerStart,
+	timerStop,
+	timerReset,
+	timerSetPeriod,
+	taskDelay,
+	taskDelayUntil,
+	eventGroupWaitBits,
+	eventGroupSync,
+	streamBufferSend,
+	streamBufferReceive
+};
+
+struct TraceRecord
+{
+	uint32_t						timestamp;
+	const void						*object;
+	TaskHandle_t					task;
+	TraceApi						api;
+	TraceEvent						event;
+};
+
+/* Class data declaration      */
+
+#if (configUSE_WRAPPER_TRACE == 1)
+/* Class definition            */
+class Trace
+{
+	static_assert((configWRAPPER_TRACE_LENGTH & (configWRAPPER_TRACE_LENGTH - 1)) == 0, "configWRAPPER_TRACE_LENGTH must be a power of two");
+
+protected:
+	inline static TraceRecord				records[WRAPPER_TRACE_CORES][configWRAPPER_TRACE_LENGTH];
+	inline static std::atomic<uint32_t>		head[WRAPPER_TRACE_CORES];
+
+public:
+	void static enableCycleCounter(void);
+
+	void static record(const void *object, TraceApi api, TraceEvent event);
+
+	const TraceRecord static *getRecords(UBaseType_t core)					{return records[core];};
+
+	uint32_t static getCount(UBaseType_t core)								{return head[core].load(std::memory_order_acquire);};
+
+	void static clear(void);
+};
+
+/**
+ * @brief		Enables the DWT cycle counter
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Enables the CycleCounter, so the default timestamp counts CPU
+ * 				cycles (Cortex-M3/M4/M7/M33). Not needed if a debugger
+ * 				already enabled it or if `configWRAPPER_TRACE_TIMESTAMP()` is
+ * 				defined to another clock.
+ * @see			CycleCounter::enable()
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Mod: Uses the shared CycleCounter
+ ****************************************************************************/
+inline void Trace::enableCycleCounter(void)
+{
+	CycleCounter::enable();
+}
+
+/**
+ * @brief		Records an event
+ *
+ * @param		object			Handle of the queue, semaphore, timer or task
+ * @param		api				Method that records the event
+ * @param		event			Type of the event
+ * @return		void
+ *
+ * @details		Stores the event with a timestamp and the calling task in the
+ * 				ring of the current core. A slot is reserved with one atomic
+ * 				fetch_add, so it's lock free and can be used from tasks and
+ * 				ISRs. Cortex-M0/M0+ (e.g. the RP2040) have no LDREX/STREX and
+ * 				the fetch_add would not be lock free, there the slot is
+ * 				reserved with the interrupts of the own core masked, the
+ * 				other core never writes to this ring. When the ring is full, the oldest records are
+ * 				overwritten. Usually called by the `WRAPPER_TRACE_ENTER()` and
+ * 				`WRAPPER_TRACE_EXIT()` macros of the wrapper methods.
+ * 				Blocking inside the kernel is recorded with the trace hooks of
+ * 				FreeRTOS, add to the FreeRTOSConfig.h:
+ * 				`extern void wrapperTraceBlock(const void *object);`
+ * 				`#define traceBLOCKING_ON_QUEUE_SEND(pxQueue) wrapperTraceBlock(pxQueue)`
+ * 				`#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) wrapperTraceBlock(pxQueue)`
+ * 				`#define traceBLOCKING_ON_QUEUE_PEEK(pxQueue) wrapperTraceBlock(pxQueue)`
+ * 				and put `WRAPPER_TRACE_BLOCK_HOOK_DEFINITION` into one .cpp
+ * 				file. Queue and semaphore handles are the same object the
+ * 				wrapper records, so the events can be matched.
+ * @warning		A record could be read while it's written, the reader must
+ * 				check with getCount() that the index was not overwritten.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ * @remark		Last Modifications:
+ * 				- 14.10.2026	NZ	Fix: Masks the interrupts to reserve the
+ * 									slot on ARMv6-M
+ ****************************************************************************/
+inline void Trace::record(const void *object, TraceApi api, TraceEvent event)
+{
+	UBaseType_t core; // Core of the caller
+	uint32_t index; // Reserved slot
+#if (WRAPPER_TRACE_ATOMIC_RMW == 0)
+	UBaseType_t mask = portSET_INTERRUPT_MASK_FROM_ISR(); // Interrupt mask of the caller
+
+	core = WRAPPER_TRACE_CORE_ID();
+	index = head[core].load(std::memory_order_relaxed);
+	head[core].store(index + 1, std::memory_order_relaxed);
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+#else
+	core = WRAPPER_TRACE_CORE_ID();
+	index = head[core].fetch_add(1, std::memory_order_relaxed);
+#endif
+
+	TraceRecord &slot = records[core][index & (configWRAPPER_TRACE_LENGTH - 1)];
+
+	slot.timestamp = configWRAPPER_TRACE_TIMESTAMP();
+	slot.object = object;
+	slot.task = xTaskGetCurrentTaskHandle();
+	slot.api = api;
+	slot.event = event;
+}
+
+/**
+ * @brief		Clears all records
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Sets the count of all cores back to zero, e.g. before a
+ * 				measurement is started.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+inline void Trace::clear(void)
+{
+	for (UBaseType_t core = 0; core < WRAPPER_TRACE_CORES; core++) {
+		head[core].store(0, std::memory_order_release);
+	}
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Trace Class													*/
+/****************************************************************************/
+#endif /* TRACE_HPP_ */
@@ -0,0 +1,485 @@
+#ifndef ZEROCOPYQUEUE_HPP_
+#define ZEROCOPYQUEUE_HPP_
+/****************************************************************************/
+/*  Header    : Zero Copy Queue Class										*/
+/****************************************************************************/
+/*                                                                          */
+/*  @file     : ZeroCopyQueue.hpp											*/
+/*                                                                          */
+/*  @brief	  : Queue that passes pointers to blocks of a fixed pool		*/
+/*                                                                          */
+/*  @author   : N. Zoller (NZ)                                              */
+/*                                                                          */
+/*  @date	  : 14.10.2026  NZ	Created                              		*/
+/*                                                                          */
+/*	@remark	  : Last Modifications:											*/
+/*				- 14.10.2026	NZ	Add: Overloads with std::chrono durations*/
+/*																			*/
+/*  @todo	  :	- Test the whole class extensively							*/
+/*																			*/
+/****************************************************************************/
+/*																			*/
+/****************************************************************************/
+
+/* imports */
+#include <chrono>
+
+#include <FreeRTOS.h>
+#include <queue.h>
+
+#include "FreeRTOS.hpp"
+
+/* Class constant declaration  */
+
+/* Class Type declaration      */
+
+/* Class data declaration      */
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Class definition            */
+template <typename T, UBaseType_t Length>
+class ZeroCopyQueue : public FreeRTOS
+{
+public:
+	class Handle
+	{
+	protected:
+		ZeroCopyQueue		*owner = NULL;
+		T					*block = NULL;
+
+		Handle(ZeroCopyQueue *blockOwner, T *blockPointer): owner(blockOwner), block(blockPointer) {};
+
+		friend class ZeroCopyQueue;
+
+	public:
+		Handle(void) {};
+		Handle(Handle &&other);
+
+		~Handle(void)														{release();};
+
+		Handle(const Handle &) = delete;
+		Handle &operator=(const Handle &) = delete;
+		Handle &operator=(Handle &&other);
+
+		void release(void);
+		void releaseFromISR(BaseType_t *higherPriorityTaskWoken);
+
+		T *get(void)														{return block;};
+		T *operator->(void)													{return block;};
+		T &operator*(void)													{return *block;};
+
+		explicit operator bool(void) const									{return (block != NULL) ? true : false;};
+	};
+
+protected:
+	T						blocks[Length];
+
+	QueueHandle_t			freeBlocks;
+	uint8_t					freeBlocksStorage[Length * sizeof(T *)];
+	StaticQueue_t			freeBlocksBuffer;
+
+	QueueHandle_t			filledBlocks;
+	uint8_t					filledBlocksStorage[Length * sizeof(T *)];
+	StaticQueue_t			filledBlocksBuffer;
+
+	TickType_t				defaultMaxTicksToWait = portMAX_DELAY;
+	TickType_t				defaultMinTicksToWait = 0;
+
+public:
+	ZeroCopyQueue(void);
+
+	~ZeroCopyQueue(void);
+
+	Handle acquire(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	Handle acquire(const std::chrono::duration<Rep, Period> timeToWait)					{return acquire(convertToTicks(timeToWait));};
+	Handle acquire(void);
+
+	Handle acquireFromISR(BaseType_t *higherPriorityTaskWoken);
+
+	bool send(Handle &block);
+
+	bool sendFromISR(Handle &block, BaseType_t *higherPriorityTaskWoken);
+
+	Handle receive(TickType_t ticksToWait);
+	template <typename Rep, typename Period>
+	Handle receive(const std::chrono::duration<Rep, Period> timeToWait)					{return receive(convertToTicks(timeToWait));};
+	Handle receive(void);
+
+	Handle receiveFromISR(BaseType_t *higherPriorityTaskWoken);
+
+	UBaseType_t messagesWaiting(void);
+
+	UBaseType_t blocksAvailable(void);
+};
+
+/**
+ * @brief		Constructor
+ *
+ * @param		void
+ *
+ * @details		Constructs a new zero copy queue with `Length` blocks of `T`.
+ * 				All blocks, the queue of free blocks and the queue of filled
+ * 				blocks are members of the object, so nothing is allocated at
+ * 				runtime. Only the pointer to a block (4 bytes) is copied by
+ * 				FreeRTOS, the block itself is filled and read in place.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline ZeroCopyQueue<T, Length>::ZeroCopyQueue(void)
+{
+	T *block; // Temporary block pointer
+
+	freeBlocks = xQueueCreateStatic(Length, sizeof(T *), freeBlocksStorage, &freeBlocksBuffer);
+	filledBlocks = xQueueCreateStatic(Length, sizeof(T *), filledBlocksStorage, &filledBlocksBuffer);
+
+	assert(freeBlocks != NULL);
+	assert(filledBlocks != NULL);
+
+	for (UBaseType_t i = 0; i < Length; i++) {
+		block = &blocks[i];
+		xQueueSendToBack(freeBlocks, &block, 0);
+	}
+};
+
+/**
+ * @brief		Destructor
+ *
+ * @param		void
+ *
+ * @details		Deletes both queues with the FreeRTOS API function
+ * 				vQueueDelete().
+ * @warning		All handles must be released before the queue is destroyed.
+ * @see			https://www.freertos.org/a00018.html#vQueueDelete
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline ZeroCopyQueue<T, Length>::~ZeroCopyQueue(void)
+{
+	vQueueDelete(filledBlocks);
+	vQueueDelete(freeBlocks);
+};
+
+/**
+ * @brief		Acquires a free block and waits the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait for a free block
+ * @return		Handle to the block, empty if no block was free in time
+ *
+ * @details		Takes a block from the pool for the producer to fill in place.
+ * 				The block is given back to the pool when the handle is
+ * 				destroyed, unless it is passed on with send().
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::acquire(TickType_t ticksToWait)
+{
+	T *block = NULL;
+
+	if (xQueueReceive(freeBlocks, &block, ticksToWait) != pdTRUE) {
+		block = NULL;
+	}
+
+	return Handle(this, block);
+}
+
+/**
+ * @brief		Acquires a free block and waits the default ticks
+ *
+ * @param		void
+ * @return		Handle to the block, empty if no block was free
+ *
+ * @details		Takes a block from the pool and waits the default amount of
+ * 				time. The default value is `0`, so it doesn't block.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::acquire(void)
+{
+	return ZeroCopyQueue<T, Length>::acquire(defaultMinTicksToWait);
+}
+
+/**
+ * @brief		Acquires a free block from an ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Handle to the block, empty if no block was free
+ *
+ * @details		Takes a block from the pool from an interrupt service routine.
+ * @warning		A handle acquired in an ISR must be passed on with
+ * 				sendFromISR() or given back with releaseFromISR(), before it
+ * 				is destroyed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::acquireFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	T *block = NULL;
+
+	if (xQueueReceiveFromISR(freeBlocks, &block, higherPriorityTaskWoken) != pdTRUE) {
+		block = NULL;
+	}
+
+	return Handle(this, block);
+}
+
+/**
+ * @brief		Sends a filled block to the consumer
+ *
+ * @param		block			Handle of the filled block
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Passes the pointer of the block through the queue, the handle
+ * 				is empty afterwards. It never blocks, because there are never
+ * 				more blocks than places in the queue.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline bool ZeroCopyQueue<T, Length>::send(Handle &block)
+{
+	if ((block.owner != this) || (block.block == NULL)) {
+		return false;
+	}
+
+	if (xQueueSendToBack(filledBlocks, &block.block, 0) != pdTRUE) {
+		return false;
+	}
+
+	block.block = NULL;
+
+	return true;
+}
+
+/**
+ * @brief		Sends a filled block to the consumer from an ISR
+ *
+ * @param		block						Handle of the filled block
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		True if it was successful, false otherwise
+ *
+ * @details		Passes the pointer of the block through the queue from an
+ * 				interrupt service routine, the handle is empty afterwards.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline bool ZeroCopyQueue<T, Length>::sendFromISR(Handle &block, BaseType_t *higherPriorityTaskWoken)
+{
+	if ((block.owner != this) || (block.block == NULL)) {
+		return false;
+	}
+
+	if (xQueueSendToBackFromISR(filledBlocks, &block.block, higherPriorityTaskWoken) != pdTRUE) {
+		return false;
+	}
+
+	block.block = NULL;
+
+	return true;
+}
+
+/**
+ * @brief		Receives a filled block and waits the given ticks
+ *
+ * @param		ticksToWait		Ticks to wait for a block
+ * @return		Handle to the block, empty if no block was received in time
+ *
+ * @details		Receives the pointer of the next filled block. The block is
+ * 				given back to the pool when the handle is destroyed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::receive(TickType_t ticksToWait)
+{
+	T *block = NULL;
+
+	if (xQueueReceive(filledBlocks, &block, ticksToWait) != pdTRUE) {
+		block = NULL;
+	}
+
+	return Handle(this, block);
+}
+
+/**
+ * @brief		Receives a filled block and waits the default ticks
+ *
+ * @param		void
+ * @return		Handle to the block, empty if no block was received
+ *
+ * @details		Receives the pointer of the next filled block and waits the
+ * 				default amount of time. The default value is `portMAX_DELAY`,
+ * 				so it waits the maximum of time.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::receive(void)
+{
+	return ZeroCopyQueue<T, Length>::receive(defaultMaxTicksToWait);
+}
+
+/**
+ * @brief		Receives a filled block from an ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		Handle to the block, empty if no block was waiting
+ *
+ * @details		Receives the pointer of the next filled block from an
+ * 				interrupt service routine.
+ * @warning		The handle must be given back with releaseFromISR() before it
+ * 				is destroyed.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle ZeroCopyQueue<T, Length>::receiveFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	T *block = NULL;
+
+	if (xQueueReceiveFromISR(filledBlocks, &block, higherPriorityTaskWoken) != pdTRUE) {
+		block = NULL;
+	}
+
+	return Handle(this, block);
+}
+
+/**
+ * @brief		Return the number of filled blocks in the queue
+ *
+ * @param		void
+ * @return		Number of blocks waiting for the consumer
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline UBaseType_t ZeroCopyQueue<T, Length>::messagesWaiting(void)
+{
+	return uxQueueMessagesWaiting(filledBlocks);
+}
+
+/**
+ * @brief		Return the number of free blocks in the pool
+ *
+ * @param		void
+ * @return		Number of blocks that can be acquired
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline UBaseType_t ZeroCopyQueue<T, Length>::blocksAvailable(void)
+{
+	return uxQueueMessagesWaiting(freeBlocks);
+}
+
+/**
+ * @brief		Move constructor of the handle
+ *
+ * @param		other			Handle to take the block from
+ *
+ * @details		Takes over the block of the other handle, which is empty
+ * 				afterwards. A handle can't be copied.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline ZeroCopyQueue<T, Length>::Handle::Handle(Handle &&other): owner(other.owner), block(other.block)
+{
+	other.block = NULL;
+};
+
+/**
+ * @brief		Move assignment of the handle
+ *
+ * @param		other			Handle to take the block from
+ * @return		Reference to this handle
+ *
+ * @details		Gives back the current block, if any, and takes over the
+ * 				block of the other handle.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline typename ZeroCopyQueue<T, Length>::Handle &ZeroCopyQueue<T, Length>::Handle::operator=(Handle &&other)
+{
+	if (this != &other) {
+		release();
+
+		owner = other.owner;
+		block = other.block;
+		other.block = NULL;
+	}
+
+	return *this;
+}
+
+/**
+ * @brief		Gives the block back to the pool
+ *
+ * @param		void
+ * @return		void
+ *
+ * @details		Gives the block back to the pool of free blocks, the handle is
+ * 				empty afterwards. Called by the destructor. It never blocks,
+ * 				because the pool always has place for all blocks.
+ * @warning		This function cannot be called from an ISR, use
+ * 				releaseFromISR() instead.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline void ZeroCopyQueue<T, Length>::Handle::release(void)
+{
+	if (block != NULL) {
+		xQueueSendToBack(owner->freeBlocks, &block, 0);
+		block = NULL;
+	}
+}
+
+/**
+ * @brief		Gives the block back to the pool from an ISR
+ *
+ * @param		higherPriorityTaskWoken		Set to pdTRUE if a context switch is required
+ * @return		void
+ *
+ * @details		Gives the block back to the pool of free blocks from an
+ * 				interrupt service routine, the handle is empty afterwards.
+ *
+ * @author		N. Zoller (NZ)
+ * @date		14.10.2026	NZ	Created
+ ****************************************************************************/
+template <typename T, UBaseType_t Length>
+inline void ZeroCopyQueue<T, Length>::Handle::releaseFromISR(BaseType_t *higherPriorityTaskWoken)
+{
+	if (block != NULL) {
+		xQueueSendToBackFromISR(owner->freeBlocks, &block, higherPriorityTaskWoken);
+		block = NULL;
+	}
+}
+#endif
+
+/****************************************************************************/
+/* End Header : Zero Copy Queue Class										*/
+/****************************************************************************/
+#endif /* ZEROCOPYQUEUE_HPP_ */